@@ -0,0 +1,52 @@
+# --------------------------------------------------------------------------------------------------------
+# Setup Pack-Tool
+# └ Host tool that bundles a directory into a single pack file, see `saucer::pack::open`.
+# --------------------------------------------------------------------------------------------------------
+
+# The tool is only built when a pack actually depends on it. When cross compiling, a host build can be supplied through
+# `saucer_pack_executable` instead.
+
+if (saucer_pack_executable)
+  add_executable(saucer-pack IMPORTED GLOBAL)
+  set_target_properties(saucer-pack PROPERTIES IMPORTED_LOCATION "${saucer_pack_executable}")
+else()
+  add_executable(saucer-pack EXCLUDE_FROM_ALL "${CMAKE_CURRENT_LIST_DIR}/../tools/pack.cpp" "${CMAKE_CURRENT_LIST_DIR}/../src/mime.cpp")
+  target_include_directories(saucer-pack PRIVATE "${CMAKE_CURRENT_LIST_DIR}/../private/saucer")
+  target_compile_features(saucer-pack PRIVATE cxx_std_23)
+  set_target_properties(saucer-pack PROPERTIES CXX_STANDARD 23 CXX_EXTENSIONS OFF CXX_STANDARD_REQUIRED ON)
+endif()
+
+# --------------------------------------------------------------------------------------------------------
+# Setup Functions
+# └ saucer_pack(<directory> OUTPUT <file> [TARGET <target>])
+# --------------------------------------------------------------------------------------------------------
+
+function(saucer_pack DIRECTORY)
+  cmake_parse_arguments(PARSE_ARGV 1 PACK "" "OUTPUT;TARGET" "")
+
+  if (NOT PACK_OUTPUT)
+    saucer_message(FATAL_ERROR "saucer_pack: OUTPUT is required")
+  endif()
+
+  cmake_path(ABSOLUTE_PATH DIRECTORY BASE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}" OUTPUT_VARIABLE directory)
+  cmake_path(ABSOLUTE_PATH PACK_OUTPUT BASE_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}" OUTPUT_VARIABLE output)
+
+  file(GLOB_RECURSE files CONFIGURE_DEPENDS "${directory}/*")
+
+  add_custom_command(
+    OUTPUT  "${output}"
+    COMMAND saucer-pack "${output}" "${directory}"
+    DEPENDS saucer-pack ${files}
+    COMMENT "Packing ${directory}"
+    VERBATIM
+  )
+
+  cmake_path(GET output FILENAME name)
+  string(MAKE_C_IDENTIFIER "${name}" name)
+
+  add_custom_target(saucer_pack_${name} ALL DEPENDS "${output}")
+
+  if (PACK_TARGET)
+    add_dependencies(${PACK_TARGET} saucer_pack_${name})
+  endif()
+endfunction()
@@ -1,13 +1,17 @@
 #pragma once
 
 #include "modules/module.hpp"
+#include "utils/cstring.hpp"
 #include "utils/required.hpp"
 
 #include "error/error.hpp"
+#include "watchdog.hpp"
+#include "instrumentation.hpp"
 
 #include <vector>
 #include <compare>
 #include <optional>
+#include <exception>
 #include <functional>
 
 #include <string>
@@ -26,6 +30,12 @@ namespace saucer
         block,
     };
 
+    enum class pressure : std::uint8_t
+    {
+        moderate,
+        critical,
+    };
+
     struct position
     {
         int x;
@@ -71,11 +81,15 @@ namespace saucer
         enum class event : std::uint8_t
         {
             quit,
+            memory,
+            exception,
         };
 
       public:
-        using events = ereignis::manager<          //
-            ereignis::event<event::quit, policy()> //
+        using events = ereignis::manager<                               //
+            ereignis::event<event::quit, policy()>,                     //
+            ereignis::event<event::memory, void(pressure)>,             //
+            ereignis::event<event::exception, void(std::exception_ptr)> //
             >;
 
       private:
@@ -103,7 +117,8 @@ namespace saucer
         [[nodiscard]] std::vector<screen> screens() const;
 
       public:
-        void post(post_callback_t) const;
+        // The site names the caller in traces and watchdog reports, it has to outlive the callback (e.g. a string literal).
+        void post(post_callback_t, const char *site = nullptr) const;
 
       public:
         int run(callback_t);
@@ -119,6 +134,21 @@ namespace saucer
         template <typename Callback, typename... Ts>
         [[sc::thread_safe]] auto invoke(Callback &&, Ts &&...) const;
 
+        // Like `invoke`, but only enqueues the callback and never blocks. Arguments are copied for this purpose and exceptions
+        // are reported through `event::exception`.
+        template <typename Callback, typename... Ts>
+        [[sc::thread_safe]] void dispatch(Callback &&, Ts &&...) const;
+
+        // Never blocks, the returned future can be awaited and resolves once the callback ran on the main thread.
+        template <typename Callback, typename... Ts>
+        [[sc::thread_safe]] auto defer(Callback &&, Ts &&...) const;
+
+      public:
+        // Reports posted callbacks, event listeners, exposed functions and event-loop iterations that exceed the threshold
+        [[sc::thread_safe]] void watch(watchdog::options);
+        [[sc::thread_safe]] void unwatch();
+        [[sc::thread_safe]] [[nodiscard]] watchdog::counters stalls() const;
+
       public:
         template <event Event>
         [[sc::thread_safe]] auto on(events::event<Event>::listener);
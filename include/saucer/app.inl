@@ -14,8 +14,54 @@ namespace saucer
 
         template <typename T, typename... Ts>
         auto make_safe(application *app, Ts &&...);
+
+        template <typename T>
+        struct owning;
+
+        template <typename T>
+        using owning_t = owning<std::decay_t<T>>::type;
+
+        template <typename T, typename U>
+        decltype(auto) pass(U &);
+
+        template <typename T>
+        auto instrument(T &&, const char *);
     } // namespace detail
 
+    template <typename T>
+    struct detail::owning
+    {
+        using type = T;
+    };
+
+    template <typename T, typename Traits>
+    struct detail::owning<basic_cstring_view<T, Traits>>
+    {
+        using type = std::basic_string<T, Traits>;
+    };
+
+    template <typename T, typename Traits>
+    struct detail::owning<std::basic_string_view<T, Traits>>
+    {
+        using type = std::basic_string<T, Traits>;
+    };
+
+    template <typename T, typename U>
+    decltype(auto) detail::pass(U &value)
+    {
+        // Views are copied into an owning string before the caller returns and have to be handed out as lvalues to convert
+        // back into a view, everything else is forwarded like the caller passed it.
+
+        if constexpr (std::same_as<U, std::decay_t<T>>)
+        {
+            return std::forward<T>(value);
+        }
+        else
+        {
+            return static_cast<U &>(value);
+        }
+    }
+
     template <typename T>
     struct detail::safe_delete
     {
@@ -25,12 +71,27 @@ namespace saucer
         void operator()(T *ptr) const;
     };
 
+    template <typename T>
+    auto detail::instrument(T &&task, [[maybe_unused]] const char *site)
+    {
+#ifdef SAUCER_INSTRUMENTATION
+        return [probe = instrumentation::probe{site}, task = std::forward<T>(task)]() mutable
+        {
+            probe.start();
+            std::invoke(task);
+            probe.finish();
+        };
+#else
+        return std::forward<T>(task);
+#endif
+    }
+
     template <typename T>
     void detail::safe_delete<T>::operator()(T *ptr) const
     {
         if (!app->thread_safe())
         {
-            return app->invoke(&safe_delete::operator(), this, ptr);
+            return app->invoke(*this, ptr);
         }
 
         delete ptr;
@@ -58,11 +119,81 @@ namespace saucer
         auto task   = std::packaged_task{std::move(task_callback)};
         auto future = task.get_future();
 
-        post([task = std::move(task)]() mutable { task(); });
+        const auto *site = instrumentation::scope::current();
+        post(detail::instrument([task = std::move(task)]() mutable { task(); }, site), site);
 
         return future.get();
     }
 
+    template <typename Callback, typename... Ts>
+    void application::dispatch(Callback &&callback, Ts &&...args) const
+    {
+        if (thread_safe())
+        {
+            std::invoke(std::forward<Callback>(callback), std::forward<Ts>(args)...);
+            return;
+        }
+
+        // Posted callbacks run in the order they were posted in, which also orders them before any (blocking) call made
+        // afterwards from the same thread.
+
+        auto task = [events = m_events, callback = std::forward<Callback>(callback),
+                     ... args = detail::owning_t<Ts>(std::forward<Ts>(args))]() mutable
+        {
+#ifdef __cpp_exceptions
+            try
+            {
+                std::invoke(std::forward<Callback>(callback), detail::pass<Ts>(args)...);
+            }
+            catch (...)
+            {
+                // Nobody waits for the callback, so instead of tearing down the event-loop the exception is reported.
+                events->template get<event::exception>().fire(std::current_exception());
+            }
+#else
+            std::invoke(std::forward<Callback>(callback), detail::pass<Ts>(args)...);
+#endif
+        };
+
+        const auto *site = instrumentation::scope::current();
+        return post(detail::instrument(std::move(task), site), site);
+    }
+
+    template <typename Callback, typename... Ts>
+    auto application::defer(Callback &&callback, Ts &&...args) const
+    {
+        using result = std::invoke_result_t<Callback, Ts...>;
+
+        auto promise = coco::promise<result>{};
+        auto rtn     = promise.get_future();
+
+        auto task = [promise = std::move(promise), callback = std::forward<Callback>(callback),
+                     ... args = detail::owning_t<Ts>(std::forward<Ts>(args))]() mutable
+        {
+            if constexpr (std::is_void_v<result>)
+            {
+                std::invoke(std::forward<Callback>(callback), detail::pass<Ts>(args)...);
+                promise.set_value();
+            }
+            else
+            {
+                promise.set_value(std::invoke(std::forward<Callback>(callback), detail::pass<Ts>(args)...));
+            }
+        };
+
+        if (thread_safe())
+        {
+            task();
+        }
+        else
+        {
+            const auto *site = instrumentation::scope::current();
+            post(detail::instrument(std::move(task), site), site);
+        }
+
+        return rtn;
+    }
+
     template <application::event Event>
     auto application::on(events::event<Event>::listener listener)
     {
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "stash/stash.hpp"
+
+#include <memory>
+#include <optional>
+
+#include <string>
+#include <filesystem>
+#include <unordered_map>
+
+namespace saucer
+{
+    namespace fs = std::filesystem;
+
+    struct embedded_file
+    {
+        stash content;
+        std::string mime;
+    };
+
+    struct assets
+    {
+        struct impl;
+
+      private:
+        std::shared_ptr<const impl> m_impl;
+
+      private:
+        assets(std::shared_ptr<const impl>);
+
+      public:
+        [[nodiscard]] std::size_t size() const;
+        [[nodiscard]] bool contains(const fs::path &) const;
+
+      public:
+        [[nodiscard]] std::optional<embedded_file> find(const fs::path &) const;
+
+      public:
+        [[nodiscard]] bool operator==(const assets &) const;
+
+      public:
+        [[nodiscard]] static assets from(std::unordered_map<fs::path, embedded_file>);
+    };
+} // namespace saucer
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "modules/module.hpp"
+
+#include "error/error.hpp"
+
+#include <chrono>
+#include <memory>
+#include <cstdint>
+#include <optional>
+#include <filesystem>
+
+namespace saucer
+{
+    namespace fs = std::filesystem;
+
+    struct application;
+
+    // Webviews created with the same context share their network session, i.e. cookies, caches and website data.
+    // Under the `shared` process policy they are also grouped into as few web processes as the backend permits.
+
+    struct context
+    {
+        struct impl;
+
+      public:
+        struct limits;
+        struct options;
+
+      public:
+        enum class process : std::uint8_t
+        {
+            shared,
+            isolated,
+        };
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      private:
+        context(std::shared_ptr<impl>);
+
+      public:
+        static result<context> create(application *, const options &);
+
+      public:
+        template <bool Stable = true>
+        [[nodiscard]] natives<context, Stable> native() const;
+    };
+
+    // Memory-pressure thresholds of the web processes, the ratios are relative to `memory` (in megabytes).
+    // Only honored by WebKitGtk, other backends manage their web processes themselves.
+
+    struct context::limits
+    {
+        std::optional<std::size_t> memory;
+        std::optional<std::chrono::milliseconds> poll_interval;
+
+      public:
+        std::optional<double> conservative;
+        std::optional<double> strict;
+        std::optional<double> kill;
+    };
+
+    struct context::options
+    {
+        std::optional<fs::path> storage_path;
+        bool persistent_cookies{true};
+
+      public:
+        std::optional<limits> memory;
+
+      public:
+        process policy{process::shared};
+    };
+} // namespace saucer
@@ -6,8 +6,11 @@
 #include "stash/stash.hpp"
 
 #include <memory>
+#include <cstdint>
 #include <filesystem>
 
+#include <coco/promise/promise.hpp>
+
 namespace saucer
 {
     namespace fs = std::filesystem;
@@ -16,6 +19,18 @@ namespace saucer
     {
         struct impl;
 
+      public:
+        struct bitmap;
+
+      public:
+        // Decoded icons can be remembered by a hash of their encoded content, so loading the same image again is free. The
+        // cache is bounded, the least recently used icons are evicted first.
+        enum class caching : std::uint8_t
+        {
+            none,
+            content,
+        };
+
       private:
         std::unique_ptr<impl> m_impl;
 
@@ -41,6 +56,7 @@ namespace saucer
       public:
         [[nodiscard]] bool empty() const;
         [[nodiscard]] stash data() const;
+        [[nodiscard]] bitmap pixels() const;
 
       public:
         void save(const fs::path &path) const;
@@ -48,5 +64,24 @@ namespace saucer
       public:
         [[nodiscard]] static result<icon> from(const stash &ico);
         [[nodiscard]] static result<icon> from(const fs::path &file);
+
+      public:
+        // Decodes on a shared pool of worker threads instead of the calling thread.
+        [[nodiscard]] static coco::future<result<icon>> from_async(stash ico, caching = caching::none);
+        [[nodiscard]] static coco::future<result<icon>> from_async(fs::path file, caching = caching::none);
+
+      public:
+        static void purge();
+    };
+
+    // Straight (non-premultiplied) RGBA, 8 bits per channel. Rows are `stride` bytes apart.
+    struct icon::bitmap
+    {
+        stash data{stash::empty()};
+
+      public:
+        std::size_t width{0};
+        std::size_t height{0};
+        std::size_t stride{0};
     };
 } // namespace saucer
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include <string>
+#include <cstddef>
+
+namespace saucer::instrumentation
+{
+    // Statistics for calls that had to hop to the main thread. Only recorded when saucer is built with
+    // `saucer_instrumentation`, otherwise the snapshot is always empty.
+
+    using clock = std::chrono::steady_clock;
+
+    struct hop
+    {
+        std::string site;
+        std::size_t calls;
+
+      public:
+        clock::duration queued;
+        clock::duration executed;
+
+      public:
+        clock::duration max_queued;
+        clock::duration max_executed;
+    };
+
+    class scope
+    {
+        const char *m_previous;
+
+      public:
+        scope(const char *site);
+
+      public:
+        scope(const scope &) = delete;
+        scope &operator=(const scope &) = delete;
+
+      public:
+        ~scope();
+
+      public:
+        [[nodiscard]] static const char *current();
+    };
+
+    class probe
+    {
+        const char *m_site;
+
+      private:
+        clock::time_point m_posted;
+        clock::time_point m_started;
+
+      public:
+        probe(const char *site);
+
+      public:
+        void start();
+        void finish() const;
+    };
+
+    [[nodiscard]] bool enabled();
+    [[nodiscard]] std::vector<hop> snapshot();
+
+    void reset();
+} // namespace saucer::instrumentation
@@ -8,6 +8,7 @@
 
 #include <QMainWindow>
 #include <QWebEngineView>
+#include <QWebEngineProfile>
 
 namespace saucer
 {
@@ -46,4 +47,10 @@ namespace saucer
     {
         QIcon icon;
     };
+
+    template <>
+    struct stable_natives<context>
+    {
+        QWebEngineProfile *profile;
+    };
 } // namespace saucer
@@ -47,4 +47,11 @@ namespace saucer
     {
         NSImage *icon;
     };
+
+    template <>
+    struct stable_natives<context>
+    {
+        WKProcessPool *pool;
+        WKWebsiteDataStore *store;
+    };
 } // namespace saucer
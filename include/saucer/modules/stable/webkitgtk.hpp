@@ -46,4 +46,11 @@ namespace saucer
     {
         GdkTexture *icon;
     };
+
+    template <>
+    struct stable_natives<context>
+    {
+        WebKitWebContext *context;
+        WebKitNetworkSession *session;
+    };
 } // namespace saucer
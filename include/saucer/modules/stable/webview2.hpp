@@ -51,4 +51,10 @@ namespace saucer
     {
         Gdiplus::Bitmap *icon;
     };
+
+    template <>
+    struct stable_natives<context>
+    {
+        ICoreWebView2Environment *environment;
+    };
 } // namespace saucer
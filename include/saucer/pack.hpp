@@ -0,0 +1,17 @@
+#pragma once
+
+#include "assets.hpp"
+#include "error/error.hpp"
+
+#include <filesystem>
+#include <unordered_map>
+
+namespace saucer::pack
+{
+    namespace fs = std::filesystem;
+
+    // Opens a pack produced by `saucer_pack`, the file is memory-mapped once and every returned
+    // `embedded_file` views into that mapping. Pages are only read in when their content is requested.
+
+    [[nodiscard]] result<std::unordered_map<fs::path, embedded_file>> open(const fs::path &);
+} // namespace saucer::pack
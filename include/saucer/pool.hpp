@@ -0,0 +1,63 @@
+#pragma once
+
+#include "webview.hpp"
+
+#include <deque>
+#include <memory>
+#include <functional>
+
+namespace saucer
+{
+    // Keeps hidden windows with fully initialized webviews around, so that opening a window does not have to wait for the
+    // webview (and its web process) to start up. Entries that are taken out are replaced on the event loop in the background.
+
+    template <typename T>
+    struct pooled
+    {
+        std::shared_ptr<saucer::window> window;
+        T webview;
+    };
+
+    template <typename T>
+    class pool
+    {
+        struct state;
+
+      public:
+        struct options;
+
+      private:
+        std::shared_ptr<state> m_state;
+
+      private:
+        pool(std::shared_ptr<state>);
+
+      public:
+        static pool create(application *, options);
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::size_t available() const;
+
+      public:
+        [[sc::thread_safe]] result<pooled<T>> take();
+    };
+
+    template <typename T>
+    struct pool<T>::options
+    {
+        std::size_t capacity{2};
+
+      public:
+        // The window of these options is replaced with a fresh (hidden) one for every entry.
+        saucer::webview::options webview{.window = nullptr};
+
+      public:
+        // Navigating to a blank page makes the backend spawn its web process ahead of time.
+        bool warm{true};
+
+      public:
+        std::function<void(pooled<T> &)> prepare;
+    };
+} // namespace saucer
+
+#include "pool.inl"
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "pool.hpp"
+
+namespace saucer
+{
+    template <typename T>
+    struct pool<T>::state
+    {
+        application *parent;
+        options opts;
+
+      public:
+        bool refilling{false};
+        std::deque<pooled<T>> entries{};
+
+      public:
+        result<pooled<T>> make();
+
+      public:
+        static void refill(const std::shared_ptr<state> &);
+    };
+
+    template <typename T>
+    result<pooled<T>> pool<T>::state::make()
+    {
+        auto window = saucer::window::create(parent);
+
+        if (!window.has_value())
+        {
+            return err(window);
+        }
+
+        auto settings   = opts.webview;
+        settings.window = window.value();
+
+        auto webview = T::create(settings);
+
+        if (!webview.has_value())
+        {
+            return err(webview);
+        }
+
+        if (opts.warm)
+        {
+            webview->set_url("about:blank");
+        }
+
+        auto rtn = pooled<T>{.window = std::move(window.value()), .webview = std::move(webview.value())};
+
+        if (opts.prepare)
+        {
+            std::invoke(opts.prepare, rtn);
+        }
+
+        return rtn;
+    }
+
+    template <typename T>
+    void pool<T>::state::refill(const std::shared_ptr<state> &self)
+    {
+        // Entries are created one per posted task, so that refilling never holds up the event loop for long.
+        // The refill state is only ever touched on the main thread, which is why `create` has to hop there first.
+
+        if (self->refilling || self->entries.size() >= self->opts.capacity)
+        {
+            return;
+        }
+
+        self->refilling = true;
+
+        self->parent->post(
+            [weak = std::weak_ptr{self}]
+            {
+                auto self = weak.lock();
+
+                if (!self)
+                {
+                    return;
+                }
+
+                self->refilling = false;
+                auto entry      = self->make();
+
+                if (!entry.has_value())
+                {
+                    return;
+                }
+
+                self->entries.emplace_back(std::move(entry.value()));
+                refill(self);
+            });
+    }
+
+    template <typename T>
+    pool<T>::pool(std::shared_ptr<state> state) : m_state(std::move(state))
+    {
+    }
+
+    template <typename T>
+    pool<T> pool<T>::create(application *parent, options opts)
+    {
+        auto rtn = pool{std::make_shared<state>(state{.parent = parent, .opts = std::move(opts)})};
+        parent->invoke(&state::refill, rtn.m_state);
+        return rtn;
+    }
+
+    template <typename T>
+    std::size_t pool<T>::available() const
+    {
+        return m_state->parent->invoke([this] { return m_state->entries.size(); });
+    }
+
+    template <typename T>
+    result<pooled<T>> pool<T>::take()
+    {
+        auto *const parent = m_state->parent;
+
+        if (!parent->thread_safe())
+        {
+            return parent->invoke(&pool::take, this);
+        }
+
+        if (m_state->entries.empty())
+        {
+            auto rtn = m_state->make();
+            state::refill(m_state);
+            return rtn;
+        }
+
+        auto rtn = std::move(m_state->entries.front());
+        m_state->entries.pop_front();
+
+        state::refill(m_state);
+
+        return rtn;
+    }
+} // namespace saucer
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../scheme.hpp"
+
+#include <set>
+#include <chrono>
+#include <memory>
+#include <optional>
+
+#include <string>
+#include <vector>
+
+namespace saucer::scheme
+{
+    struct cache
+    {
+        struct impl;
+
+      public:
+        struct stats;
+        struct options;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      private:
+        static std::shared_ptr<impl> make(resolver, const options &);
+
+      public:
+        template <typename T>
+        cache(T &&handler, const options &);
+
+      public:
+        void operator()(request, executor) const;
+
+      public:
+        [[nodiscard]] stats metrics() const;
+
+      public:
+        void invalidate() const;
+        void invalidate(const saucer::url &) const;
+    };
+
+    struct cache::stats
+    {
+        std::size_t hits;
+        std::size_t misses;
+        std::size_t evictions;
+
+      public:
+        std::size_t size;
+        std::size_t entries;
+    };
+
+    struct cache::options
+    {
+        std::size_t max_size{16 * 1024 * 1024};
+        std::size_t max_entry_size{2 * 1024 * 1024};
+
+      public:
+        std::optional<std::chrono::steady_clock::duration> ttl;
+
+      public:
+        std::vector<std::string> vary;
+        std::set<std::string, std::less<>> methods{"GET", "HEAD"};
+    };
+} // namespace saucer::scheme
+
+#include "cache.inl"
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "cache.hpp"
+#include "../traits/traits.hpp"
+
+namespace saucer::scheme
+{
+    template <typename T>
+    cache::cache(T &&handler, const options &opts)
+    {
+        using transformer = traits::transformer<std::decay_t<T>, std::tuple<request>, executor>;
+        m_impl            = make(resolver{transformer{std::forward<T>(handler)}}, opts);
+    }
+} // namespace saucer::scheme
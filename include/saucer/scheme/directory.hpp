@@ -0,0 +1,53 @@
+#pragma once
+
+#include "../scheme.hpp"
+#include "../utils/required.hpp"
+
+#include <memory>
+#include <cstdint>
+#include <optional>
+#include <filesystem>
+
+namespace saucer::scheme
+{
+    namespace fs = std::filesystem;
+
+    struct directory
+    {
+        struct impl;
+
+      public:
+        struct options;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        directory(const options &);
+
+      public:
+        void operator()(const request &, const executor &) const;
+
+      public:
+        void invalidate() const;
+        void invalidate(const fs::path &) const;
+    };
+
+    struct directory::options
+    {
+        required<fs::path> root;
+        std::string index{"index.html"};
+
+      public:
+        std::size_t cache_size{32 * 1024 * 1024};
+
+      public:
+        // Files of at least this size are memory-mapped instead of copied. Only use this if files are replaced (i.e. renamed over)
+        // rather than rewritten in place: truncating a file that is still mapped raises SIGBUS in whoever reads the response.
+        std::optional<std::size_t> map_threshold;
+
+      public:
+        // Uses a file-system watcher (inotify) to invalidate entries, otherwise every cache hit is revalidated with a `stat`.
+        bool watch{true};
+    };
+} // namespace saucer::scheme
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../scheme.hpp"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <functional>
+
+#include <string>
+#include <string_view>
+
+namespace saucer::scheme
+{
+    struct route
+    {
+        saucer::url url;
+        std::map<std::string, std::string, std::less<>> params;
+
+      public:
+        [[nodiscard]] std::optional<std::string_view> param(std::string_view) const;
+    };
+
+    struct router
+    {
+        struct impl;
+
+      public:
+        using endpoint = std::function<void(request, route, executor)>;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        router();
+
+      private:
+        void add(std::string, std::string_view, endpoint &&);
+
+      public:
+        template <typename T>
+        router &add(std::string method, std::string_view pattern, T &&handler);
+
+      public:
+        void operator()(request, executor) const;
+    };
+} // namespace saucer::scheme
+
+#include "router.inl"
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "router.hpp"
+#include "../traits/traits.hpp"
+
+namespace saucer::scheme
+{
+    template <typename T>
+    router &router::add(std::string method, std::string_view pattern, T &&handler)
+    {
+        using transformer = traits::transformer<std::decay_t<T>, std::tuple<request, route>, executor>;
+        add(std::move(method), pattern, endpoint{transformer{std::forward<T>(handler)}});
+
+        return *this;
+    }
+} // namespace saucer::scheme
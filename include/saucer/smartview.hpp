@@ -49,6 +49,7 @@ namespace saucer
 
       public:
         static result<basic_smartview> create(const options &);
+        static coco::future<result<basic_smartview>> create_async(const options &);
 
       public:
         template <typename T>
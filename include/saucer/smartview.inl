@@ -25,6 +25,27 @@ namespace saucer
         return basic_smartview{std::move(*base)};
     }
 
+    template <Serializer Serializer>
+    coco::future<result<basic_smartview<Serializer>>> basic_smartview<Serializer>::create_async(const options &opts)
+    {
+        auto promise = coco::promise<result<basic_smartview>>{};
+        auto rtn     = promise.get_future();
+
+        auto created = [promise = std::move(promise)](result<webview> base) mutable
+        {
+            if (!base.has_value())
+            {
+                return promise.set_value(result<basic_smartview>{err(base)});
+            }
+
+            promise.set_value(basic_smartview{std::move(*base)});
+        };
+
+        webview::create_async(opts, std::move(created));
+
+        return rtn;
+    }
+
     template <Serializer Serializer>
     template <typename... Ts>
     void basic_smartview<Serializer>::execute(format_string<Serializer, Ts...> code, Ts &&...params)
@@ -2,12 +2,14 @@
 
 #include <memory>
 #include <cstdint>
+#include <functional>
 
 #include <string>
 #include <string_view>
 
 #include <span>
 #include <vector>
+#include <utility>
 #include <variant>
 
 namespace saucer
@@ -16,6 +18,12 @@ namespace saucer
     {
         template <typename T>
         struct lazy;
+
+        template <typename T>
+        struct shared;
+
+        // Runs the task on saucer's shared background workers.
+        void prefetch(std::move_only_function<void()>);
     };
 
     template <typename T>
@@ -23,8 +31,9 @@ namespace saucer
     {
         using owning_t  = std::vector<std::remove_const_t<T>>;
         using viewing_t = std::span<std::add_const_t<T>>;
+        using shared_t  = detail::shared<std::add_const_t<T>>;
         using lazy_t    = std::shared_ptr<detail::lazy<basic_stash<T>>>;
-        using variant_t = std::variant<owning_t, viewing_t, lazy_t>;
+        using variant_t = std::variant<shared_t, viewing_t, lazy_t>;
 
       private:
         variant_t m_data;
@@ -40,11 +49,22 @@ namespace saucer
         [[nodiscard]] std::string str()
             requires std::same_as<T, std::uint8_t>;
 
+      public:
+        [[nodiscard]] std::pair<const void *, std::size_t> identity() const;
+
+      public:
+        void prefetch() const;
+        [[nodiscard]] basic_stash persist() const;
+        [[nodiscard]] basic_stash slice(std::size_t offset, std::size_t length = std::dynamic_extent) const;
+
       public:
         [[nodiscard]] static basic_stash from(owning_t);
         [[nodiscard]] static basic_stash view(viewing_t);
         [[nodiscard]] static basic_stash lazy(lazy_t);
 
+      public:
+        [[nodiscard]] static basic_stash share(std::shared_ptr<const void> owner, viewing_t);
+
       public:
         [[nodiscard]] static basic_stash from_str(std::string_view)
             requires std::same_as<T, std::uint8_t>;
@@ -57,6 +77,10 @@ namespace saucer
             requires std::same_as<std::invoke_result_t<Callback>, basic_stash<T>>
         [[nodiscard]] static basic_stash lazy(Callback);
 
+        template <typename Callback>
+            requires std::same_as<std::invoke_result_t<Callback>, basic_stash<T>>
+        [[nodiscard]] static basic_stash async(Callback);
+
       public:
         [[nodiscard]] static basic_stash empty();
     };
@@ -3,7 +3,12 @@
 #include "stash.hpp"
 #include "../utils/overload.hpp"
 
+#include <mutex>
+#include <tuple>
+
 #include <optional>
+#include <exception>
+#include <algorithm>
 #include <functional>
 
 namespace saucer
@@ -15,7 +20,11 @@ namespace saucer
 
       private:
         callback_t m_callback;
+
+      private:
+        std::once_flag m_flag;
         std::optional<T> m_value;
+        std::exception_ptr m_error;
 
       public:
         lazy(callback_t callback) : m_callback(std::move(callback)) {}
@@ -25,13 +34,54 @@ namespace saucer
             requires std::is_lvalue_reference_v<Self>
         [[nodiscard]] auto &value(this Self &&self)
         {
-            if (!self.m_value.has_value())
+            // Copies of a stash share the same lazy, concurrent readers wait for the first one to produce the value.
+            // The callback is kept alive afterwards as it may own the memory the produced stash is viewing.
+            // A throwing callback is not retried, every reader gets the same exception instead.
+
+            std::call_once(self.m_flag, [&self] { self.produce(); });
+
+            if (self.m_error)
             {
-                self.m_value.emplace(self.m_callback());
+                std::rethrow_exception(self.m_error);
             }
 
             return *std::forward<Self>(self).m_value;
         }
+
+      private:
+        void produce()
+        {
+#ifdef __cpp_exceptions
+            try
+            {
+                m_value.emplace(m_callback());
+            }
+            catch (...)
+            {
+                m_error = std::current_exception();
+            }
+#else
+            m_value.emplace(m_callback());
+#endif
+        }
+    };
+
+    template <typename T>
+    struct detail::shared
+    {
+        std::shared_ptr<const void> owner;
+        std::span<T> view;
+
+      public:
+        [[nodiscard]] T *data() const
+        {
+            return view.data();
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return view.size();
+        }
     };
 
     template <typename T>
@@ -71,10 +121,85 @@ namespace saucer
         return {begin, end};
     }
 
+    template <typename T>
+    std::pair<const void *, std::size_t> basic_stash<T>::identity() const
+    {
+        // Identifies the underlying storage without touching it, lazy stashes are identified by their producer.
+
+        auto visitor = overload{
+            [](const lazy_t &data) { return std::pair<const void *, std::size_t>{data.get(), std::dynamic_extent}; },
+            [](const auto &data) { return std::pair<const void *, std::size_t>{data.data(), data.size()}; },
+        };
+
+        return std::visit(visitor, m_data);
+    }
+
+    template <typename T>
+    void basic_stash<T>::prefetch() const
+    {
+        if (!std::holds_alternative<lazy_t>(m_data))
+        {
+            return;
+        }
+
+        auto producer = [data = std::get<lazy_t>(m_data)]
+        {
+#ifdef __cpp_exceptions
+            try
+            {
+                std::ignore = data->value();
+            }
+            catch (...) // NOLINT(*-empty-catch)
+            {
+                // The exception is kept by the lazy and rethrown to whoever reads the stash.
+            }
+#else
+            std::ignore = data->value();
+#endif
+        };
+
+        detail::prefetch(std::move(producer));
+    }
+
+    template <typename T>
+    basic_stash<T> basic_stash<T>::persist() const
+    {
+        // Shared and lazy stashes already keep their storage alive, only plain views have to be copied.
+
+        if (!std::holds_alternative<viewing_t>(m_data))
+        {
+            return *this;
+        }
+
+        const auto &data = std::get<viewing_t>(m_data);
+        return from(owning_t{data.begin(), data.end()});
+    }
+
+    template <typename T>
+    basic_stash<T> basic_stash<T>::slice(std::size_t offset, std::size_t length) const
+    {
+        auto clamp = [offset, length](viewing_t data)
+        {
+            const auto start = std::min(offset, data.size());
+            return data.subspan(start, std::min(length, data.size() - start));
+        };
+
+        auto visitor = overload{
+            [&](const shared_t &data) { return basic_stash{shared_t{data.owner, clamp(data.view)}}; },
+            [&](const viewing_t &data) { return basic_stash{clamp(data)}; },
+            [&](const lazy_t &data) { return lazy([data, offset, length] { return data->value().slice(offset, length); }); },
+        };
+
+        return std::visit(visitor, m_data);
+    }
+
     template <typename T>
     basic_stash<T> basic_stash<T>::from(owning_t data)
     {
-        return {std::move(data)};
+        // The buffer is immutable from here on, which allows copies (and slices) to share it.
+
+        auto owner = std::make_shared<const owning_t>(std::move(data));
+        return {shared_t{.owner = owner, .view = *owner}};
     }
 
     template <typename T>
@@ -89,6 +214,12 @@ namespace saucer
         return {std::move(data)};
     }
 
+    template <typename T>
+    basic_stash<T> basic_stash<T>::share(std::shared_ptr<const void> owner, viewing_t data)
+    {
+        return {shared_t{std::move(owner), data}};
+    }
+
     template <typename T>
     basic_stash<T> basic_stash<T>::from_str(std::string_view data)
         requires std::same_as<T, std::uint8_t>
@@ -96,7 +227,7 @@ namespace saucer
         auto *const begin = reinterpret_cast<const T *>(data.data());
         auto *const end   = reinterpret_cast<const T *>(data.data() + data.size());
 
-        return {owning_t{begin, end}};
+        return from(owning_t{begin, end});
     }
 
     template <typename T>
@@ -117,6 +248,17 @@ namespace saucer
         return {std::make_shared<detail::lazy<basic_stash<T>>>(std::move(callback))};
     }
 
+    template <typename T>
+    template <typename Callback>
+        requires std::same_as<std::invoke_result_t<Callback>, basic_stash<T>>
+    basic_stash<T> basic_stash<T>::async(Callback callback)
+    {
+        auto rtn = lazy(std::move(callback));
+        rtn.prefetch();
+
+        return rtn;
+    }
+
     template <typename T>
     basic_stash<T> basic_stash<T>::empty()
     {
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "error/error.hpp"
+
+#include <cstdint>
+#include <cstddef>
+
+#include <filesystem>
+#include <string_view>
+
+namespace saucer::trace
+{
+    namespace fs = std::filesystem;
+
+    // Spans are recorded into per-thread ring buffers while tracing is running, older spans are overwritten once a buffer
+    // is full. `flush` writes the buffered spans to a Chrome trace-event file (`chrome://tracing` or ui.perfetto.dev).
+
+    void start(std::size_t capacity = 16384);
+    void stop();
+
+    [[nodiscard]] bool enabled();
+    [[nodiscard]] result<> flush(const fs::path &);
+
+    class span
+    {
+        const char *m_category;
+        std::string_view m_name;
+
+      private:
+        std::uint64_t m_start;
+
+      public:
+        span(const char *category, std::string_view name);
+
+      public:
+        span(const span &)            = delete;
+        span &operator=(const span &) = delete;
+
+      public:
+        ~span();
+    };
+} // namespace saucer::trace
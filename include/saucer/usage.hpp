@@ -0,0 +1,21 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+namespace saucer
+{
+    // A snapshot of a web process. The cpu time is cumulative, so the load is the difference between two samples divided by the
+    // time that passed in between them.
+
+    struct usage
+    {
+        std::uint32_t process;
+        std::chrono::steady_clock::time_point time;
+
+      public:
+        std::chrono::nanoseconds cpu_time;
+        std::size_t resident;
+    };
+} // namespace saucer
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+namespace saucer::watchdog
+{
+    using clock = std::chrono::steady_clock;
+
+    enum class origin : std::uint8_t
+    {
+        loop,
+        task,
+        event,
+        exposed,
+    };
+
+    struct stall
+    {
+        origin kind;
+        std::string name;
+
+      public:
+        clock::duration duration;
+    };
+
+    struct counters
+    {
+        std::size_t loop;
+        std::size_t task;
+        std::size_t event;
+        std::size_t exposed;
+
+      public:
+        clock::duration longest;
+    };
+
+    struct options
+    {
+        clock::duration threshold{std::chrono::milliseconds{50}};
+        std::function<void(const stall &)> callback;
+    };
+} // namespace saucer::watchdog
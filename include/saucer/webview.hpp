@@ -11,14 +11,19 @@
 
 #include "url.hpp"
 #include "icon.hpp"
+#include "usage.hpp"
+#include "context.hpp"
+#include "assets.hpp"
 #include "script.hpp"
 #include "permission.hpp"
 
 #include "scheme.hpp"
 #include "navigation.hpp"
 
+#include <chrono>
 #include <memory>
 #include <optional>
+#include <functional>
 
 #include <compare>
 #include <cstdint>
@@ -48,12 +53,6 @@ namespace saucer
         unhandled,
     };
 
-    struct embedded_file
-    {
-        stash content;
-        std::string mime;
-    };
-
     struct bounds
     {
         int x, y;
@@ -86,6 +85,7 @@ namespace saucer
             favicon,
             title,
             load,
+            usage,
         };
 
       public:
@@ -99,7 +99,8 @@ namespace saucer
             ereignis::event<event::request, void(const saucer::url &)>,                               //
             ereignis::event<event::favicon, void(const icon &)>,                                      //
             ereignis::event<event::title, void(std::string_view)>,                                    //
-            ereignis::event<event::load, void(const state &)>                                         //
+            ereignis::event<event::load, void(const state &)>,                                        //
+            ereignis::event<event::usage, void(const saucer::usage &)>                                //
             >;
 
       protected:
@@ -109,12 +110,24 @@ namespace saucer
       private:
         webview(application *);
 
+      private:
+        static result<webview> launch(const options &);
+        result<> complete(const options &);
+
+      protected:
+        using created_t = std::move_only_function<void(result<webview>)>;
+        static void create_async(const options &, created_t);
+
       public:
         webview(webview &&) noexcept;
 
       public:
         static result<webview> create(const options &);
 
+        // Never blocks, native setup of webviews requested together overlaps (where the backend allows for it).
+        // Awaiting the returned future from the main thread has to happen through a coroutine or continuation.
+        static coco::future<result<webview>> create_async(const options &);
+
       public:
         ~webview();
 
@@ -150,6 +163,11 @@ namespace saucer
       public:
         [[sc::thread_safe]] [[nodiscard]] saucer::bounds bounds() const;
 
+      public:
+        // The web process backing this webview, only known once the backend has created it.
+        [[sc::thread_safe]] [[nodiscard]] std::optional<std::uint32_t> process_id() const;
+        [[sc::thread_safe]] [[nodiscard]] std::optional<saucer::usage> usage() const;
+
       public:
         [[sc::thread_safe]] void set_url(const saucer::url &);
         [[sc::thread_safe]] void set_url(cstring_view);
@@ -176,12 +194,21 @@ namespace saucer
       public:
         [[sc::thread_safe]] void reload();
 
+      public:
+        // Asks the backend to drop what it can rebuild on demand, e.g. in response to `application::event::memory`.
+        [[sc::thread_safe]] void release_memory();
+        [[sc::thread_safe]] coco::future<void> clear_cache();
+
       public:
         [[sc::thread_safe]] void serve(fs::path);
+
+      public:
+        [[sc::thread_safe]] void embed(assets);
         [[sc::thread_safe]] void embed(embedded_files);
 
       public:
         [[sc::thread_safe]] void unembed();
+        [[sc::thread_safe]] void unembed(const assets &);
         [[sc::thread_safe]] void unembed(const fs::path &);
 
       public:
@@ -222,6 +249,7 @@ namespace saucer
 
       public:
         bool attributes{true};
+        bool preload_hints{false};
         bool persistent_cookies{true};
         bool hardware_acceleration{true};
 
@@ -231,6 +259,19 @@ namespace saucer
 
       public:
         std::set<std::string> browser_flags;
+
+      public:
+        // When set, `event::usage` is fired with a fresh sample of the web process in the given interval.
+        std::optional<std::chrono::milliseconds> sample_interval;
+
+        // WebKitGtk only: Webviews that don't use a `context` share the default web context, which has a single extensions
+        // directory the application may already use. saucer only installs its web process extension there (which is needed
+        // for `process_id` and `event::usage`) when asked to.
+        bool process_extension{false};
+
+      public:
+        // When set, the storage related options above are taken from the context instead.
+        std::optional<saucer::context> context;
     };
 } // namespace saucer
 
@@ -87,6 +87,11 @@ namespace saucer
       public:
         static result<std::shared_ptr<window>> create(application *);
 
+      public:
+        // Creation is always posted to the event loop, so several windows can be requested without waiting on each other.
+        // Awaiting the returned future from the main thread has to happen through a coroutine or continuation.
+        static coco::future<result<std::shared_ptr<window>>> create_async(application *);
+
       public:
         ~window();
 
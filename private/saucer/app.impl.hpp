@@ -2,13 +2,18 @@
 
 #include <saucer/app.hpp>
 
+#include "queue.hpp"
+#include "ticker.hpp"
+
 #include <thread>
+#include <chrono>
 
 namespace saucer
 {
     struct application::impl
     {
         struct native;
+        struct task;
 
       public:
         application::events events;
@@ -17,9 +22,17 @@ namespace saucer
         std::thread::id thread;
         coco::future<void> finish;
 
+      public:
+        utils::queue<task> tasks;
+        static constexpr auto budget = std::chrono::milliseconds{8};
+
       public:
         std::unique_ptr<native> platform;
 
+      public:
+        // Declared last so that its thread is joined before anything it posts to is torn down.
+        utils::ticker ticker;
+
       public:
         impl();
 
@@ -35,7 +48,17 @@ namespace saucer
       public:
         int run(application *, callback_t);
 
+      public:
+        void drain();
+        void schedule(post_callback_t) const;
+
       public:
         void quit();
     };
+
+    struct application::impl::task
+    {
+        post_callback_t callback;
+        const char *site;
+    };
 } // namespace saucer
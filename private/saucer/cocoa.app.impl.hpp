@@ -12,6 +12,7 @@ namespace saucer
     struct application::impl::native
     {
         NSApplication *application;
+        dispatch_source_t memory_source;
 
       public:
         std::string id;
@@ -23,6 +24,7 @@ namespace saucer
       public:
         static void iteration();
         static screen convert(NSScreen *);
+        static pressure convert(unsigned long);
 
       public:
         static void init_menu();
@@ -3,6 +3,7 @@
 #include <saucer/icon.hpp>
 
 #include "cocoa.utils.hpp"
+#include "icon.cache.hpp"
 
 #import <Cocoa/Cocoa.h>
 
@@ -11,5 +12,8 @@ namespace saucer
     struct icon::impl
     {
         utils::objc_ptr<NSImage> icon;
+
+      public:
+        std::shared_ptr<utils::icon_cache> cache{std::make_shared<utils::icon_cache>()};
     };
 } // namespace saucer
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <saucer/context.hpp>
+
+#include <memory>
+
+namespace saucer
+{
+    struct context::impl
+    {
+        struct native;
+
+      public:
+        application *parent;
+        context::options opts;
+
+      public:
+        std::unique_ptr<native> platform;
+
+      public:
+        impl();
+
+      public:
+        ~impl();
+
+      public:
+        result<> init_platform();
+    };
+} // namespace saucer
@@ -13,6 +13,10 @@ namespace saucer
     {
         utils::g_object_ptr<AdwApplication> application;
 
+      public:
+        gulong memory_warning{0};
+        utils::g_object_ptr<GMemoryMonitor> memory_monitor;
+
       public:
         int argc;
         char **argv;
@@ -24,6 +28,7 @@ namespace saucer
       public:
         static void iteration();
         static screen convert(GdkMonitor *);
+        static pressure convert(GMemoryMonitorWarningLevel);
 
       public:
         static std::string fix_id(const std::string &);
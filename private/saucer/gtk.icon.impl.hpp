@@ -3,6 +3,7 @@
 #include <saucer/icon.hpp>
 
 #include "gtk.utils.hpp"
+#include "icon.cache.hpp"
 
 #include <gtk/gtk.h>
 
@@ -11,5 +12,8 @@ namespace saucer
     struct icon::impl
     {
         utils::g_object_ptr<GdkTexture> texture;
+
+      public:
+        std::shared_ptr<utils::icon_cache> cache{std::make_shared<utils::icon_cache>()};
     };
 } // namespace saucer
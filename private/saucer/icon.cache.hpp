@@ -0,0 +1,29 @@
+#pragma once
+
+#include <saucer/icon.hpp>
+
+#include <mutex>
+#include <memory>
+
+namespace saucer::utils
+{
+    // Native icons are immutable, so their encoded and decoded forms are computed once and shared by every copy.
+    class icon_cache
+    {
+        std::once_flag m_encoded_flag;
+        stash m_encoded{stash::empty()};
+
+      private:
+        std::once_flag m_decoded_flag;
+        icon::bitmap m_decoded;
+
+      public:
+        template <typename Callback>
+        stash encoded(Callback &&);
+
+        template <typename Callback>
+        icon::bitmap decoded(Callback &&);
+    };
+} // namespace saucer::utils
+
+#include "icon.cache.inl"
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "icon.cache.hpp"
+
+#include <functional>
+
+namespace saucer::utils
+{
+    template <typename Callback>
+    stash icon_cache::encoded(Callback &&callback)
+    {
+        std::call_once(m_encoded_flag, [&] { m_encoded = std::invoke(std::forward<Callback>(callback)); });
+        return m_encoded;
+    }
+
+    template <typename Callback>
+    icon::bitmap icon_cache::decoded(Callback &&callback)
+    {
+        std::call_once(m_decoded_flag, [&] { m_decoded = std::invoke(std::forward<Callback>(callback)); });
+        return m_decoded;
+    }
+} // namespace saucer::utils
@@ -16,6 +16,13 @@ namespace saucer::utils
 
     template <detail::callback Callback, typename T, typename... Ts>
     constexpr auto invoke(T *, Ts &&...);
+
+    template <typename Callback, typename T, typename... Ts>
+        requires std::invocable<Callback, T *, Ts...>
+    constexpr void dispatch(Callback &&, T *, Ts &&...);
+
+    template <detail::callback Callback, typename T, typename... Ts>
+    constexpr void dispatch(T *, Ts &&...);
 } // namespace saucer::utils
 
 #include "invoke.inl"
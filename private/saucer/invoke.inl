@@ -2,12 +2,17 @@
 
 #include "invoke.hpp"
 
+#include <memory>
 #include <utility>
+#include <functional>
 #include <algorithm>
 #include <string_view>
+#include <source_location>
 
 #include <rebind/member.hpp>
 
+#include "instrumentation.hpp"
+
 namespace saucer::utils
 {
     namespace detail
@@ -24,12 +29,21 @@ namespace saucer::utils
       public:
         T value;
         char name[N + 1]{};
+        char site[N + 1]{};
 
       public:
-        constexpr callback(T value, std::string_view func = __builtin_FUNCTION()) : value(value)
+        constexpr callback(T value, std::string_view func = __builtin_FUNCTION(),
+                           std::source_location location = std::source_location::current())
+            : value(value)
         {
             auto pure = func.substr(0, func.find_first_of("(<"));
             std::copy_n(pure.data(), std::min(pure.size(), N), name); // NOLINT(*-stringview-data-usage)
+
+            // The full signature (e.g. `bool saucer::window::visible() const`) is trimmed to the qualified name of the caller
+            auto signature = std::string_view{location.function_name()};
+            signature      = signature.substr(0, signature.find('('));
+            signature      = signature.substr(signature.find_last_of(' ') + 1);
+            std::copy_n(signature.data(), std::min(signature.size(), N), site); // NOLINT(*-stringview-data-usage)
         }
     };
 
@@ -65,6 +79,47 @@ namespace saucer::utils
         static constexpr auto pure = name.substr(0, name.find_first_of("(<"));
         static_assert(pure == Callback.name, "Name of implementation does not match interface");
 
+        // Names the interface method in traces and watchdog reports, it is picked up when the call is posted.
+        const auto scope = instrumentation::scope{Callback.site};
+
         return invoke(Callback.value, self, std::forward<Ts>(args)...);
     }
+
+    template <typename Callback, typename T, typename... Ts>
+        requires std::invocable<Callback, T *, Ts...>
+    constexpr void dispatch(Callback &&callback, T *self, Ts &&...args)
+    {
+        if (!self)
+        {
+            return;
+        }
+
+        // The callback is only enqueued, the impl may be destroyed (on the main thread) before it gets to run.
+
+        auto guarded = [alive = std::weak_ptr{self->alive}, callback = std::forward<Callback>(callback)]<typename... Us>(
+                           T *target, Us &&...params) mutable
+        {
+            if (alive.expired())
+            {
+                return;
+            }
+
+            std::invoke(callback, target, std::forward<Us>(params)...);
+        };
+
+        return self->parent->dispatch(std::move(guarded), self, std::forward<Ts>(args)...);
+    }
+
+    template <detail::callback Callback, typename T, typename... Ts>
+    constexpr void dispatch(T *self, Ts &&...args)
+    {
+        static constexpr auto name = rebind::member_name<Callback.value>;
+        static constexpr auto pure = name.substr(0, name.find_first_of("(<"));
+        static_assert(pure == Callback.name, "Name of implementation does not match interface");
+
+        // Names the interface method in traces and watchdog reports, it is picked up when the call is posted.
+        const auto scope = instrumentation::scope{Callback.site};
+
+        return dispatch(Callback.value, self, std::forward<Ts>(args)...);
+    }
 } // namespace saucer::utils
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <memory>
-#include <shared_mutex>
 
 namespace saucer::utils
 {
@@ -61,12 +60,19 @@ namespace saucer::utils
     template <typename T>
     class rental<T>::lock
     {
-        std::shared_ptr<state> m_state;
-        std::shared_lock<std::shared_mutex> m_guard;
+        state *m_state;
+        bool m_acquired{false};
 
       public:
         explicit lock(const rental &);
 
+      public:
+        lock(const lock &)            = delete;
+        lock &operator=(const lock &) = delete;
+
+      public:
+        ~lock();
+
       public:
         [[nodiscard]] T *value() const;
     };
@@ -3,7 +3,8 @@
 #include "lease.hpp"
 #include "invoke.hpp"
 
-#include <mutex>
+#include <atomic>
+#include <cstdint>
 #include <optional>
 
 namespace saucer::utils
@@ -11,8 +12,14 @@ namespace saucer::utils
     template <typename T>
     struct lease<T>::state
     {
+        // The upper bit marks the lease as revoked, the remaining bits count the rentals that are currently accessing the
+        // value. Borrowing is a single atomic increment, which is a lot cheaper than a shared mutex under contention.
+
+        static constexpr std::uint32_t revoked = 1u << 31;
+
+      public:
         std::optional<T> value;
-        std::shared_mutex mutex;
+        std::atomic_uint32_t borrowers{0};
     };
 
     template <typename T>
@@ -37,7 +44,15 @@ namespace saucer::utils
             return;
         }
 
-        std::unique_lock guard{m_state->mutex};
+        auto &borrowers = m_state->borrowers;
+        auto current    = borrowers.fetch_or(state::revoked, std::memory_order_acq_rel) | state::revoked;
+
+        // New rentals fail from here on, we only have to wait for the ones that are still accessing the value.
+        while (current != state::revoked)
+        {
+            borrowers.wait(current, std::memory_order_acquire);
+            current = borrowers.load(std::memory_order_acquire);
+        }
 
         m_state->value.reset();
     }
@@ -75,13 +90,52 @@ namespace saucer::utils
     }
 
     template <typename T>
-    rental<T>::lock::lock(const rental &other) : m_state(other.m_state), m_guard(m_state->mutex)
+    rental<T>::lock::lock(const rental &other) : m_state(other.m_state.get())
+    {
+        if (!m_state)
+        {
+            return;
+        }
+
+        auto &borrowers     = m_state->borrowers;
+        const auto previous = borrowers.fetch_add(1, std::memory_order_acquire);
+
+        if (!(previous & state::revoked))
+        {
+            m_acquired = true;
+            return;
+        }
+
+        if (borrowers.fetch_sub(1, std::memory_order_release) == (state::revoked | 1))
+        {
+            borrowers.notify_all();
+        }
+    }
+
+    template <typename T>
+    rental<T>::lock::~lock()
     {
+        if (!m_acquired)
+        {
+            return;
+        }
+
+        auto &borrowers = m_state->borrowers;
+
+        if (borrowers.fetch_sub(1, std::memory_order_release) == (state::revoked | 1))
+        {
+            borrowers.notify_all();
+        }
     }
 
     template <typename T>
     T *rental<T>::lock::value() const
     {
+        if (!m_acquired)
+        {
+            return nullptr;
+        }
+
         auto &rtn = m_state->value;
 
         if (!rtn.has_value())
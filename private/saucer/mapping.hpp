@@ -0,0 +1,38 @@
+#pragma once
+
+#include <saucer/error/error.hpp>
+
+#include <span>
+#include <cstdint>
+#include <filesystem>
+
+namespace saucer::utils
+{
+    namespace fs = std::filesystem;
+
+    class mapping
+    {
+        void *m_data{nullptr};
+        std::size_t m_size{0};
+
+      private:
+        mapping(void *, std::size_t);
+
+      public:
+        mapping();
+
+      public:
+        mapping(mapping &&) noexcept;
+        mapping &operator=(mapping &&) noexcept;
+
+      public:
+        ~mapping();
+
+      public:
+        [[nodiscard]] std::size_t size() const;
+        [[nodiscard]] std::span<const std::uint8_t> data() const;
+
+      public:
+        [[nodiscard]] static result<mapping> map(const fs::path &);
+    };
+} // namespace saucer::utils
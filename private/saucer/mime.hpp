@@ -0,0 +1,13 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <cstdint>
+#include <filesystem>
+
+namespace saucer::utils
+{
+    namespace fs = std::filesystem;
+
+    [[nodiscard]] std::string mime(const fs::path &, std::span<const std::uint8_t>);
+} // namespace saucer::utils
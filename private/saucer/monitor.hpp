@@ -0,0 +1,45 @@
+#pragma once
+
+#include <saucer/app.hpp>
+#include <saucer/watchdog.hpp>
+
+#include <string_view>
+
+namespace saucer::watchdog
+{
+    class timer
+    {
+        origin m_kind;
+        std::string_view m_name;
+
+      private:
+        bool m_active;
+        clock::time_point m_start;
+
+      public:
+        timer(origin, std::string_view);
+
+      public:
+        timer(const timer &)            = delete;
+        timer &operator=(const timer &) = delete;
+
+      public:
+        ~timer();
+    };
+
+    void start(application *, options);
+    void stop();
+
+    // Called whenever work is queued onto an idle event-loop.
+    void arm();
+
+    [[nodiscard]] counters snapshot();
+} // namespace saucer::watchdog
+
+namespace saucer::utils
+{
+    template <auto Event, typename Events, typename... Ts>
+    decltype(auto) fire(Events &, Ts &&...);
+} // namespace saucer::utils
+
+#include "monitor.inl"
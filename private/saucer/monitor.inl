@@ -0,0 +1,24 @@
+#pragma once
+
+#include "monitor.hpp"
+
+#include <saucer/trace.hpp>
+
+#include <format>
+
+#include <rebind/name.hpp>
+#include <rebind/utils/enum.hpp>
+
+namespace saucer::utils
+{
+    template <auto Event, typename Events, typename... Ts>
+    decltype(auto) fire(Events &events, Ts &&...args)
+    {
+        static const auto name = std::format("{}::{}", rebind::type_name<decltype(Event)>,
+                                             rebind::utils::find_enum_name(Event).value_or("unknown"));
+
+        const auto span  = trace::span{"event", name};
+        const auto timer = watchdog::timer{watchdog::origin::event, name};
+        return events.template get<Event>().fire(std::forward<Ts>(args)...);
+    }
+} // namespace saucer::utils
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <filesystem>
+
+#include <map>
+#include <vector>
+#include <unordered_map>
+
+namespace saucer::utils
+{
+    namespace fs = std::filesystem;
+
+    class preloader
+    {
+        using clock = std::chrono::steady_clock;
+
+      private:
+        struct recording
+        {
+            fs::path document;
+            std::vector<fs::path> resources;
+
+          public:
+            clock::time_point started;
+        };
+
+        struct pending
+        {
+            std::mutex mutex;
+            std::map<fs::path, std::vector<fs::path>> orders;
+
+          public:
+            std::mutex writing;
+        };
+
+      private:
+        std::optional<fs::path> m_directory;
+        std::optional<recording> m_current;
+        std::shared_ptr<pending> m_pending;
+        std::unordered_map<fs::path, std::vector<fs::path>> m_orders;
+
+      public:
+        preloader(std::optional<fs::path> directory);
+
+      public:
+        ~preloader();
+
+      public:
+        void document(const fs::path &);
+        void resource(const fs::path &);
+
+      public:
+        [[nodiscard]] const std::vector<fs::path> &order(const fs::path &document) const;
+
+      public:
+        [[nodiscard]] static fs::path file(const fs::path &directory, const fs::path &document);
+
+      private:
+        void load();
+        void save(const fs::path &document);
+
+      private:
+        void finish();
+    };
+} // namespace saucer::utils
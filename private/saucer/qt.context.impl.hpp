@@ -0,0 +1,13 @@
+#pragma once
+
+#include "context.impl.hpp"
+
+#include <QWebEngineProfile>
+
+namespace saucer
+{
+    struct context::impl::native
+    {
+        std::shared_ptr<QWebEngineProfile> profile;
+    };
+} // namespace saucer
@@ -2,15 +2,24 @@
 
 #include <saucer/icon.hpp>
 
+#include "icon.cache.hpp"
+
 #include <QIcon>
+#include <QImage>
 
 namespace saucer
 {
     struct icon::impl
     {
-        QIcon icon;
+        // Icons decoded on a worker only carry the `QImage`, the `QIcon` is created on first use (on the gui thread).
+        mutable QIcon icon;
+        QImage image;
+
+      public:
+        std::shared_ptr<utils::icon_cache> cache{std::make_shared<utils::icon_cache>()};
 
       public:
-        [[nodiscard]] std::optional<QPixmap> pixmap() const;
+        [[nodiscard]] const QIcon &get() const;
+        [[nodiscard]] std::optional<QImage> largest() const;
     };
 } // namespace saucer
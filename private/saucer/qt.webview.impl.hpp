@@ -35,7 +35,7 @@ namespace saucer
 
     struct webview::impl::native
     {
-        std::unique_ptr<QWebEngineProfile> profile;
+        std::shared_ptr<QWebEngineProfile> profile;
 
       public:
         utils::deferred_ptr<QWebEngineView> web_view;
@@ -52,10 +52,6 @@ namespace saucer
         std::size_t id_counter{0};
         std::unordered_map<std::size_t, qt_script> scripts;
 
-      public:
-        bool dom_loaded{false};
-        std::vector<std::string> pending;
-
       public:
         std::size_t on_closed;
         QMetaObject::Connection on_load;
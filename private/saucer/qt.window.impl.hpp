@@ -38,6 +38,7 @@ namespace saucer
         void changeEvent(QEvent *) override;
         void closeEvent(QCloseEvent *) override;
         void resizeEvent(QResizeEvent *) override;
+        void moveEvent(QMoveEvent *) override;
     };
 
     class overlay_layout : public QLayout
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace saucer::utils
+{
+    template <typename T>
+    class queue
+    {
+        struct node;
+
+      private:
+        std::atomic<node *> m_head{nullptr};
+
+      private:
+        node *m_backlog{nullptr};
+        node *m_tail{nullptr};
+
+      public:
+        queue();
+
+      public:
+        ~queue();
+
+      public:
+        bool push(T);
+
+        template <typename Rep, typename Period, typename Callback>
+        bool drain(std::chrono::duration<Rep, Period> budget, Callback &&);
+    };
+} // namespace saucer::utils
+
+#include "queue.inl"
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "queue.hpp"
+
+#include <memory>
+#include <functional>
+#include <utility>
+
+namespace saucer::utils
+{
+    template <typename T>
+    struct queue<T>::node
+    {
+        T value;
+        node *next;
+    };
+
+    template <typename T>
+    queue<T>::queue() = default;
+
+    template <typename T>
+    queue<T>::~queue()
+    {
+        for (auto *head : {m_head.exchange(nullptr), m_backlog})
+        {
+            while (head)
+            {
+                delete std::exchange(head, head->next);
+            }
+        }
+    }
+
+    template <typename T>
+    bool queue<T>::push(T value)
+    {
+        // Producers only ever touch the head, the consumer takes the whole list at once which keeps this free of ABA issues.
+
+        auto *const item = new node{std::move(value), m_head.load(std::memory_order_relaxed)};
+
+        while (!m_head.compare_exchange_weak(item->next, item, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+
+        return item->next == nullptr;
+    }
+
+    template <typename T>
+    template <typename Rep, typename Period, typename Callback>
+    bool queue<T>::drain(std::chrono::duration<Rep, Period> budget, Callback &&callback)
+    {
+        // Must only be called from a single (consumer) thread. Items that do not fit into the budget are kept in the
+        // backlog and run first on the next drain, so ordering is preserved.
+
+        auto *batch    = m_head.exchange(nullptr, std::memory_order_acquire);
+        node *reversed = nullptr;
+        node *last     = batch;
+
+        while (batch)
+        {
+            auto *const next = batch->next;
+            batch->next      = reversed;
+            reversed         = std::exchange(batch, next);
+        }
+
+        if (reversed)
+        {
+            (m_tail ? m_tail->next : m_backlog) = reversed;
+            m_tail                              = last;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+
+        while (m_backlog)
+        {
+            auto item = std::unique_ptr<node>{std::exchange(m_backlog, m_backlog->next)};
+
+            if (!m_backlog)
+            {
+                m_tail = nullptr;
+            }
+
+            std::invoke(callback, std::move(item->value));
+
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                break;
+            }
+        }
+
+        return m_backlog != nullptr;
+    }
+} // namespace saucer::utils
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <saucer/usage.hpp>
+
+#include <cstdint>
+#include <optional>
+
+namespace saucer::utils
+{
+    std::optional<usage> sample(std::uint32_t process);
+} // namespace saucer::utils
@@ -52,17 +52,20 @@ namespace saucer::scripts
 
     {0}
 
-    document.addEventListener("mousedown", async ({{ x, y, target, button, detail }}) => 
+    window.saucer.internal.state = {{
+        maximized: false,
+        minimized: false,
+    }};
+
+    document.addEventListener("mousedown", async ({{ target, button, detail }}) => 
     {{
-        if (button !== 0)
+        if (button !== 0 || !(target instanceof Element))
         {{
             return;
         }}
 
-        const elements  = document.elementsFromPoint(x, y);
-        
-        const has       = (name) => elements.some(elem => elem.hasAttribute(name));
-        const attribute = (name) => elements.find(elem => elem.hasAttribute(name))?.getAttribute(name);
+        const has       = (name) => target.closest(`[${{name}}]`) !== null;
+        const attribute = (name) => target.closest(`[${{name}}]`)?.getAttribute(name);
 
         if (has("data-webview-close"))
         {{
@@ -80,8 +83,7 @@ namespace saucer::scripts
 
         if (maximize === "" || (maximize === "double" && detail === 2))
         {{
-            const maximized = await window.saucer.maximized();
-            await window.saucer.maximize(!maximized);
+            await window.saucer.maximize(!window.saucer.internal.state.maximized);
             return;
         }}
 
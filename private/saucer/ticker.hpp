@@ -0,0 +1,58 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <functional>
+#include <stop_token>
+#include <condition_variable>
+
+namespace saucer
+{
+    struct application;
+}
+
+namespace saucer::utils
+{
+    // One timer per application for periodic work (e.g. usage samples), instead of a thread per webview. Due callbacks are
+    // batched into a single task that is posted to the main thread.
+
+    class ticker
+    {
+        using clock = std::chrono::steady_clock;
+
+      private:
+        struct entry
+        {
+            std::chrono::milliseconds interval;
+            clock::time_point deadline;
+            std::function<void()> callback;
+        };
+
+      private:
+        application *m_parent{nullptr};
+        std::size_t m_counter{0};
+
+      private:
+        std::mutex m_mutex;
+        std::condition_variable_any m_condition;
+
+      private:
+        bool m_changed{false};
+        std::map<std::size_t, entry> m_entries;
+        std::shared_ptr<std::atomic_bool> m_pending{std::make_shared<std::atomic_bool>(false)};
+
+      private:
+        std::jthread m_thread;
+
+      private:
+        void run(const std::stop_token &);
+
+      public:
+        std::size_t add(application *, std::chrono::milliseconds, std::function<void()>);
+        void remove(std::size_t);
+    };
+} // namespace saucer::utils
@@ -2,6 +2,11 @@
 
 #include <saucer/webview.hpp>
 
+#include "lease.hpp"
+#include "preload.hpp"
+
+#include <vector>
+
 namespace saucer
 {
     struct webview::impl
@@ -15,13 +20,31 @@ namespace saucer
         application *parent;
         webview::events events;
 
+      public:
+        std::shared_ptr<void> alive{std::make_shared<bool>()};
+
       public:
         bool attributes;
+        std::optional<std::size_t> id_maximize;
+        std::optional<std::size_t> id_minimize;
+
+      public:
         embedded_files embedded;
+        std::vector<assets> attached;
+        std::optional<utils::preloader> preloader;
+
+      public:
+        bool dom_loaded{false};
+        std::vector<std::string> pending;
 
       public:
+        utils::lease<impl *> lease;
         std::unique_ptr<native> platform;
 
+      public:
+        // Registered with the application's ticker when `options::sample_interval` is set.
+        std::optional<std::size_t> id_sample;
+
       public:
         impl();
 
@@ -29,6 +52,8 @@ namespace saucer
         ~impl();
 
       public:
+        // Starts what can progress on its own (e.g. a web-process), `init_platform` completes the setup in a later task.
+        result<> launch_platform(const options &);
         result<> init_platform(const options &);
 
       public:
@@ -37,6 +62,8 @@ namespace saucer
 
       public:
         void handle_embed(const scheme::request &, const scheme::executor &);
+        [[nodiscard]] std::optional<embedded_file> find_embedded(const fs::path &) const;
+        [[nodiscard]] std::string preload_hints(const fs::path &) const;
         void handle_scheme(const std::string &, scheme::resolver &&);
 
       public:
@@ -61,6 +88,9 @@ namespace saucer
       public:
         [[nodiscard]] saucer::bounds bounds() const;
 
+      public:
+        [[nodiscard]] std::optional<std::uint32_t> process_id() const;
+
       public:
         void set_url(const saucer::url &);
         void set_html(cstring_view);
@@ -85,8 +115,17 @@ namespace saucer
         void reload();
 
       public:
+        void release_memory();
+        coco::future<void> clear_cache();
+
+      public:
+        void flush();
         void execute(cstring_view);
+        void evaluate(cstring_view);
+
+      public:
         std::size_t inject(const script &);
+        void inject_builtin(const script &);
 
       public:
         void uninject();
@@ -97,8 +136,10 @@ namespace saucer
         static void register_scheme(const std::string &);
 
       public:
+        void push_state();
         status on_message(std::string_view);
 
+
       public:
         static std::string ready_script();
         static std::string creation_script();
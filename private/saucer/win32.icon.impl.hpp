@@ -2,6 +2,8 @@
 
 #include <saucer/icon.hpp>
 
+#include "icon.cache.hpp"
+
 #include <windows.h>
 #include <gdiplus.h>
 
@@ -10,5 +12,8 @@ namespace saucer
     struct icon::impl
     {
         std::shared_ptr<Gdiplus::Bitmap> bitmap;
+
+      public:
+        std::shared_ptr<utils::icon_cache> cache{std::make_shared<utils::icon_cache>()};
     };
 } // namespace saucer
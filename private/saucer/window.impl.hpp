@@ -2,16 +2,29 @@
 
 #include <saucer/window.hpp>
 
+#include "invoke.hpp"
+
+#include <memory>
+#include <atomic>
+#include <cstdint>
+
 namespace saucer
 {
     struct window::impl
     {
         struct native;
+        struct snapshot;
 
       public:
         application *parent;
         window::events events;
 
+      public:
+        std::shared_ptr<void> alive{std::make_shared<bool>()};
+
+      public:
+        std::unique_ptr<snapshot> state;
+
       public:
         std::unique_ptr<native> platform;
 
@@ -28,6 +41,14 @@ namespace saucer
         template <event Event>
         void setup();
 
+      public:
+        void refresh();
+        [[nodiscard]] bool cached() const;
+
+      public:
+        template <utils::detail::callback Callback, typename... Ts>
+        void update(Ts...);
+
       public:
         [[nodiscard]] bool visible() const;
         [[nodiscard]] bool focused() const;
@@ -100,4 +121,47 @@ namespace saucer
       public:
         void set_position(saucer::position);
     };
+
+    struct window::impl::snapshot
+    {
+        struct values;
+
+      public:
+        std::atomic_bool ready{false};
+        std::atomic_size_t pending{0};
+
+      public:
+        // Published as a whole (seqlock), so that readers never see e.g. the size and position of two different updates.
+        std::atomic_uint64_t sequence{0};
+
+      public:
+        std::atomic_bool visible;
+        std::atomic_bool focused;
+
+      public:
+        std::atomic_bool minimized;
+        std::atomic_bool maximized;
+
+      public:
+        std::atomic_uint64_t size;
+        std::atomic_uint64_t position;
+
+      public:
+        void store(const values &);
+        [[nodiscard]] values load() const;
+    };
+
+    struct window::impl::snapshot::values
+    {
+        bool visible;
+        bool focused;
+
+      public:
+        bool minimized;
+        bool maximized;
+
+      public:
+        saucer::size size;
+        saucer::position position;
+    };
 } // namespace saucer
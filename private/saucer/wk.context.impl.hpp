@@ -0,0 +1,16 @@
+#pragma once
+
+#include "context.impl.hpp"
+
+#include "cocoa.utils.hpp"
+
+#import <WebKit/WebKit.h>
+
+namespace saucer
+{
+    struct context::impl::native
+    {
+        utils::objc_ptr<WKProcessPool> pool;
+        utils::objc_ptr<WKWebsiteDataStore> store;
+    };
+} // namespace saucer
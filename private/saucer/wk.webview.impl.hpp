@@ -39,10 +39,6 @@ namespace saucer
         std::size_t id_counter{0};
         std::map<std::size_t, script> scripts;
 
-      public:
-        bool dom_loaded{false};
-        std::vector<std::string> pending;
-
       public:
         std::size_t on_closed;
 
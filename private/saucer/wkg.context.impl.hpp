@@ -0,0 +1,27 @@
+#pragma once
+
+#include "context.impl.hpp"
+
+#include "gtk.utils.hpp"
+
+#include <webkit/webkit.h>
+
+namespace saucer
+{
+    struct context::impl::native
+    {
+        utils::g_object_ptr<WebKitWebContext> context;
+        utils::g_object_ptr<WebKitNetworkSession> session;
+        bool extension{false};
+
+      public:
+        // The most recently created webview, new webviews are related to it to share its web process.
+        GWeakRef related;
+
+      public:
+        [[nodiscard]] WebKitWebView *make_view(process, WebKitSettings *);
+
+      public:
+        static WebKitWebContext *make_context(const std::optional<limits> &);
+    };
+} // namespace saucer
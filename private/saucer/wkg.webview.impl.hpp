@@ -5,7 +5,10 @@
 #include "gtk.utils.hpp"
 #include "wkg.scheme.impl.hpp"
 
+#include <map>
+#include <optional>
 #include <vector>
+#include <utility>
 
 #include <webkit/webkit.h>
 
@@ -20,6 +23,12 @@ namespace saucer
         bool clearable;
     };
 
+    struct wkg_bundle
+    {
+        std::string code;
+        script_ptr ref;
+    };
+
     struct webview::impl::native
     {
         WebKitWebView *web_view;
@@ -32,13 +41,18 @@ namespace saucer
         content_manager_ptr manager;
         utils::g_object_ptr<WebKitSettings> settings;
 
+      public:
+        std::optional<icon> favicon;
+        std::optional<std::uint32_t> pid;
+        bool extension{false};
+
       public:
         std::size_t id_counter{0};
         std::unordered_map<std::size_t, wkg_script> scripts;
 
       public:
-        bool dom_loaded{false};
-        std::vector<std::string> pending;
+        // Our own scripts are merged into a single user script per injection point (`run_at`, `no_frames`)
+        std::map<std::pair<script::time, bool>, wkg_bundle> builtins;
 
       public:
         std::size_t id_context;
@@ -46,6 +60,7 @@ namespace saucer
 
       public:
         std::size_t id_message;
+        std::size_t id_user_message;
 
       public:
         std::size_t id_click;
@@ -61,12 +76,17 @@ namespace saucer
       public:
         static void on_message(WebKitWebView *, JSCValue *, impl *);
         static void on_load(WebKitWebView *, WebKitLoadEvent, impl *);
+        static gboolean on_user_message(WebKitWebView *, WebKitUserMessage *, impl *);
 
       public:
         static void on_click(GtkGestureClick *, gint, gdouble, gdouble, impl *);
         static void on_release(GtkGestureClick *, gdouble, gdouble, guint, GdkEventSequence *, impl *);
 
       public:
+        static WebKitUserScript *make_script(const std::string &, script::time, bool no_frames);
+
+      public:
+        static bool load_extension(WebKitWebContext *);
         static WebKitSettings *make_settings(const options &);
         static inline std::unordered_map<std::string, std::unique_ptr<scheme::handler>> schemes;
     };
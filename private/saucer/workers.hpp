@@ -0,0 +1,40 @@
+#pragma once
+
+#include <mutex>
+#include <deque>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <stop_token>
+#include <condition_variable>
+
+namespace saucer::utils
+{
+    // A small, process-wide pool for background work (decoding, prefetching) that should neither block the caller nor spawn a
+    // thread per task.
+
+    class workers
+    {
+        using task_t = std::move_only_function<void()>;
+
+      private:
+        std::mutex m_mutex;
+        std::condition_variable_any m_condition;
+        std::deque<task_t> m_tasks;
+
+      private:
+        std::vector<std::jthread> m_threads;
+
+      private:
+        workers();
+
+      private:
+        void work(const std::stop_token &);
+
+      public:
+        void submit(task_t);
+
+      public:
+        static workers &shared();
+    };
+} // namespace saucer::utils
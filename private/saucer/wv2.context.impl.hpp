@@ -0,0 +1,25 @@
+#pragma once
+
+#include "context.impl.hpp"
+
+#include <cstdint>
+#include <optional>
+
+#include <wrl.h>
+#include <WebView2.h>
+
+namespace saucer
+{
+    using Microsoft::WRL::ComPtr;
+
+    struct context::impl::native
+    {
+        // Created together with the first webview of the context, as it needs that webview's browser arguments.
+        ComPtr<ICoreWebView2Environment> environment;
+
+      public:
+        // Set when the environment uses a temporary user-data folder, which is removed once the last webview let go of it.
+        std::uint32_t browser_pid;
+        std::optional<fs::path> cleanup;
+    };
+} // namespace saucer
@@ -34,6 +34,9 @@ namespace saucer
     using FaviconChanged       = ICoreWebView2FaviconChangedEventHandler;
     using GetFavicon           = ICoreWebView2GetFaviconCompletedHandler;
     using SourceChanged        = ICoreWebView2SourceChangedEventHandler;
+    using DataCleared          = ICoreWebView2ClearBrowsingDataCompletedHandler;
+    using ProcessesChanged     = ICoreWebView2ProcessInfosChangedEventHandler;
+    using GetProcesses         = ICoreWebView2GetProcessExtendedInfosCompletedHandler;
 
     struct environment_options
     {
@@ -64,23 +67,32 @@ namespace saucer
       public:
         icon favicon;
 
-      public:
-        bool dom_loaded{false};
-        std::vector<std::string> pending;
-
       public:
         std::size_t id_counter{0};
         std::map<std::size_t, wv2_script> scripts;
         std::unordered_map<std::string, scheme::resolver> schemes;
 
       public:
-        std::size_t on_resize, on_minimize;
+        std::size_t on_resize, on_minimize, on_focus;
         std::optional<saucer::bounds> bounds;
 
+      public:
+        // Set by `release_memory`, the target level is only raised again on the next navigation or once we regain focus.
+        bool trimmed{false};
+
       public:
         std::uint32_t browser_pid;
         std::optional<fs::path> cleanup;
 
+      public:
+        // Keeps the context (and with it a temporary user-data folder it may own) alive for as long as we use its environment.
+        std::optional<saucer::context> context;
+
+      public:
+        ComPtr<ICoreWebView2Environment> environment;
+        std::optional<EventRegistrationToken> processes_changed;
+        std::optional<std::uint32_t> renderer;
+
       public:
         utils::lease<webview::impl *> lease;
 
@@ -93,6 +105,7 @@ namespace saucer
 
       public:
         static result<fs::path> default_user_folder(std::wstring &);
+        static void remove_user_folder(std::uint32_t, const fs::path &);
         static result<ComPtr<ICoreWebView2Environment>> create_environment(application *, const environment_options &);
         static result<ComPtr<ICoreWebView2Controller>> create_controller(application *, HWND, ICoreWebView2Environment *);
 
@@ -109,6 +122,11 @@ namespace saucer
         static HRESULT on_fullscreen(impl *, ICoreWebView2 *, IUnknown *);
         static HRESULT on_window(impl *, ICoreWebView2 *, ICoreWebView2NewWindowRequestedEventArgs *);
 
+      public:
+        static HRESULT on_processes(impl *, ICoreWebView2Environment *, IUnknown *);
+        static void restore_memory(impl *);
+        static std::optional<std::uint32_t> find_renderer(ICoreWebView2ProcessExtendedInfoCollection *, UINT32);
+
       public:
         static HRESULT scheme_handler(impl *, const scheme_options &);
 
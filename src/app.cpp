@@ -1,9 +1,14 @@
 #include "app.impl.hpp"
 
 #include "error.impl.hpp"
+#include "monitor.hpp"
+#include "trace.hpp"
+#include "icon.hpp"
 
 namespace saucer
 {
+    using impl = application::impl;
+
     application::application() : m_impl(std::make_unique<impl>())
     {
         m_events = &m_impl->events;
@@ -40,7 +45,11 @@ namespace saucer
             return;
         }
 
+        watchdog::stop();
         m_events->clear(true);
+
+        // Cached icons hold native resources which must not outlive the application
+        icon::purge();
     }
 
     bool application::thread_safe() const
@@ -87,6 +96,43 @@ namespace saucer
         return m_impl->run(this, std::move(callback));
     }
 
+    void impl::drain()
+    {
+        // Whatever does not fit into the budget is picked up by the next wake-up, so that input and paint events queued
+        // by the platform in the meantime are not starved by a burst of posted callbacks.
+
+        auto run = [](task &&value)
+        {
+            const auto *site = value.site ? value.site : "saucer::application::post";
+
+            const auto span  = trace::span{"invoke", site};
+            const auto timer = watchdog::timer{watchdog::origin::task, site};
+
+            std::move(value.callback)();
+        };
+
+        if (!tasks.drain(budget, run))
+        {
+            return;
+        }
+
+        schedule([this] { drain(); });
+    }
+
+    void application::post(post_callback_t callback, const char *site) const
+    {
+        // Only the first callback pushed onto an empty queue wakes the event-loop, all others are picked up by the same drain.
+
+        if (!m_impl->tasks.push({std::move(callback), site}))
+        {
+            return;
+        }
+
+        watchdog::arm();
+
+        m_impl->schedule([impl = m_impl.get()] { impl->drain(); });
+    }
+
     coco::future<void> application::finish()
     {
         return std::move(m_impl->finish);
@@ -104,7 +150,7 @@ namespace saucer
             return invoke(&application::quit, this);
         }
 
-        if (m_events->get<event::quit>().fire().find(policy::block))
+        if (utils::fire<event::quit>(*m_events).find(policy::block))
         {
             return;
         }
@@ -112,6 +158,26 @@ namespace saucer
         m_impl->quit();
     }
 
+    void application::watch(watchdog::options opts)
+    {
+        if (!m_impl)
+        {
+            return;
+        }
+
+        watchdog::start(this, std::move(opts));
+    }
+
+    void application::unwatch()
+    {
+        watchdog::stop();
+    }
+
+    watchdog::counters application::stalls() const // NOLINT(*-static)
+    {
+        return watchdog::snapshot();
+    }
+
     void application::off(event event)
     {
         if (!m_impl)
@@ -0,0 +1,204 @@
+#include "assets.hpp"
+
+#include <mutex>
+#include <utility>
+#include <cstring>
+#include <algorithm>
+#include <string_view>
+
+namespace saucer
+{
+    struct blob
+    {
+        mutable stash content;
+        mutable std::once_flag deduplicated;
+    };
+
+    struct assets::impl
+    {
+        struct entry
+        {
+            std::shared_ptr<const blob> content;
+            std::string mime;
+        };
+
+      public:
+        std::unordered_map<fs::path, entry> files;
+    };
+
+    struct identity_hash
+    {
+        std::size_t operator()(const std::pair<const void *, std::size_t> &key) const
+        {
+            return std::hash<const void *>{}(key.first) ^ (std::hash<std::size_t>{}(key.second) << 1);
+        }
+    };
+
+    class registry
+    {
+        using identity = std::pair<const void *, std::size_t>;
+
+      private:
+        std::mutex m_mutex;
+        std::size_t m_threshold{64};
+
+      private:
+        std::unordered_map<identity, std::weak_ptr<const blob>, identity_hash> m_identities;
+        std::unordered_multimap<std::size_t, std::weak_ptr<const blob>> m_contents;
+
+      public:
+        [[nodiscard]] std::shared_ptr<const blob> intern(stash);
+        [[nodiscard]] stash resolve(const std::shared_ptr<const blob> &);
+
+      private:
+        void deduplicate(const std::shared_ptr<const blob> &);
+        void prune();
+
+      public:
+        [[nodiscard]] static registry &instance();
+    };
+
+    registry &registry::instance()
+    {
+        // Intentionally leaked, blobs may outlive static destruction when held by a detached webview.
+        static auto *instance = new registry;
+        return *instance;
+    }
+
+    std::shared_ptr<const blob> registry::intern(stash content)
+    {
+        // Interning only looks at the storage a stash refers to, so neither lazy stashes nor mapped files are read here.
+        // Plain views are kept as they are, just like `webview::embed` does, which is what `saucer_embed` relies on.
+
+        const auto key = content.identity();
+
+        std::lock_guard guard{m_mutex};
+
+        if (auto it = m_identities.find(key); it != m_identities.end())
+        {
+            if (auto existing = it->second.lock(); existing)
+            {
+                return existing;
+            }
+        }
+
+        prune();
+
+        auto rtn = std::make_shared<const blob>(std::move(content));
+        m_identities.insert_or_assign(key, rtn);
+
+        return rtn;
+    }
+
+    stash registry::resolve(const std::shared_ptr<const blob> &entry)
+    {
+        std::call_once(entry->deduplicated, [this, &entry] { deduplicate(entry); });
+        return entry->content;
+    }
+
+    void registry::deduplicate(const std::shared_ptr<const blob> &entry)
+    {
+        // Identical contents from distinct storage are merged once they are first served, at which point their pages have to be
+        // read in anyway. Later lookups are then handed the surviving copy, and ours is released along with its last user.
+
+        const auto &content = entry->content;
+        auto bytes          = std::string_view{};
+
+#ifdef __cpp_exceptions
+        try
+        {
+            bytes = {reinterpret_cast<const char *>(content.data()), content.size()};
+        }
+        catch (...)
+        {
+            // Failing lazy stashes keep their exception and rethrow it to whoever reads them.
+            return;
+        }
+#else
+        bytes = {reinterpret_cast<const char *>(content.data()), content.size()};
+#endif
+
+        const auto hash = std::hash<std::string_view>{}(bytes);
+
+        std::lock_guard guard{m_mutex};
+
+        for (auto [it, end] = m_contents.equal_range(hash); it != end; ++it)
+        {
+            auto existing = it->second.lock();
+
+            if (!existing || existing == entry || existing->content.size() != bytes.size())
+            {
+                continue;
+            }
+
+            if (std::memcmp(existing->content.data(), bytes.data(), bytes.size()) != 0)
+            {
+                continue;
+            }
+
+            entry->content = existing->content;
+            return;
+        }
+
+        m_contents.emplace(hash, entry);
+    }
+
+    void registry::prune()
+    {
+        // Expired entries are only swept once the tables doubled in size, which keeps interning amortized O(1).
+
+        if (m_identities.size() + m_contents.size() < m_threshold)
+        {
+            return;
+        }
+
+        std::erase_if(m_identities, [](const auto &entry) { return entry.second.expired(); });
+        std::erase_if(m_contents, [](const auto &entry) { return entry.second.expired(); });
+
+        m_threshold = std::max(64uz, (m_identities.size() + m_contents.size()) * 2);
+    }
+
+    assets::assets(std::shared_ptr<const impl> data) : m_impl(std::move(data)) {}
+
+    std::size_t assets::size() const
+    {
+        return m_impl->files.size();
+    }
+
+    bool assets::contains(const fs::path &file) const
+    {
+        return m_impl->files.contains(file);
+    }
+
+    std::optional<embedded_file> assets::find(const fs::path &file) const
+    {
+        const auto it = m_impl->files.find(file);
+
+        if (it == m_impl->files.end())
+        {
+            return std::nullopt;
+        }
+
+        return embedded_file{.content = registry::instance().resolve(it->second.content), .mime = it->second.mime};
+    }
+
+    bool assets::operator==(const assets &other) const
+    {
+        return m_impl == other.m_impl;
+    }
+
+    assets assets::from(std::unordered_map<fs::path, embedded_file> files)
+    {
+        auto &registry = registry::instance();
+        auto rtn       = std::make_shared<impl>();
+
+        rtn->files.reserve(files.size());
+
+        for (auto &[path, file] : files)
+        {
+            rtn->files.emplace(path, impl::entry{.content = registry.intern(std::move(file.content)), .mime = std::move(file.mime)});
+        }
+
+        return {std::move(rtn)};
+    }
+} // namespace saucer
@@ -0,0 +1,326 @@
+#include "scheme/cache.hpp"
+
+#include <list>
+#include <mutex>
+#include <cctype>
+#include <algorithm>
+#include <unordered_map>
+
+namespace saucer::scheme
+{
+    using clock = std::chrono::steady_clock;
+
+    struct cached
+    {
+        std::string key;
+        std::string url;
+
+      public:
+        response value;
+        std::size_t size;
+
+      public:
+        std::optional<clock::time_point> expires;
+    };
+
+    struct cache::impl
+    {
+        resolver handler;
+
+      public:
+        std::size_t max_size;
+        std::size_t max_entry_size;
+        std::optional<clock::duration> ttl;
+
+      public:
+        std::vector<std::string> vary;
+        std::set<std::string, std::less<>> methods;
+
+      public:
+        std::mutex mutex;
+        std::size_t used{0};
+
+      public:
+        // Bumped by every invalidation, responses of requests that started before it are not cached.
+        std::size_t generation{0};
+
+      public:
+        std::size_t hits{0};
+        std::size_t misses{0};
+        std::size_t evictions{0};
+
+      public:
+        std::list<cached> entries;
+        std::unordered_map<std::string, std::list<cached>::iterator> lookup;
+
+      public:
+        [[nodiscard]] std::string key(const request &, std::string_view method, std::string_view url) const;
+
+      public:
+        [[nodiscard]] std::size_t stamp();
+
+      public:
+        std::optional<response> find(const std::string &);
+        void insert(std::string key, std::string url, std::size_t generation, response &);
+
+      public:
+        void clear();
+        void erase(std::list<cached>::iterator);
+    };
+
+    static bool iequals(std::string_view lhs, std::string_view rhs)
+    {
+        auto lower = [](char c)
+        {
+            return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        };
+
+        return std::ranges::equal(lhs, rhs, {}, lower, lower);
+    }
+
+    static std::optional<std::string> header(const std::map<std::string, std::string> &headers, std::string_view name)
+    {
+        // Header names are case-insensitive, and the backends do not agree on a canonical casing.
+
+        const auto it = std::ranges::find_if(headers, [name](const auto &entry) { return iequals(entry.first, name); });
+
+        if (it == headers.end())
+        {
+            return std::nullopt;
+        }
+
+        return it->second;
+    }
+
+    static std::size_t footprint(const response &value)
+    {
+        auto rtn = value.data.size() + value.mime.size();
+
+        for (const auto &[name, content] : value.headers)
+        {
+            rtn += name.size() + content.size();
+        }
+
+        return rtn;
+    }
+
+    static bool cacheable(const response &value)
+    {
+        if (value.status < 200 || value.status >= 300)
+        {
+            return false;
+        }
+
+        const auto control = header(value.headers, "Cache-Control");
+
+        return !control.has_value() || !control->contains("no-store");
+    }
+
+    std::string cache::impl::key(const request &req, std::string_view method, std::string_view url) const
+    {
+        auto rtn = std::string{method};
+
+        rtn += ' ';
+        rtn += url;
+
+        if (vary.empty())
+        {
+            return rtn;
+        }
+
+        const auto headers = req.headers();
+
+        for (const auto &name : vary)
+        {
+            rtn += '\n';
+            rtn += name;
+            rtn += ':';
+            rtn += header(headers, name).value_or("");
+        }
+
+        return rtn;
+    }
+
+    std::size_t cache::impl::stamp()
+    {
+        std::lock_guard guard{mutex};
+        return generation;
+    }
+
+    std::optional<response> cache::impl::find(const std::string &key)
+    {
+        std::lock_guard guard{mutex};
+
+        const auto it = lookup.find(key);
+
+        if (it == lookup.end())
+        {
+            ++misses;
+            return std::nullopt;
+        }
+
+        const auto current = it->second;
+
+        if (current->expires.has_value() && clock::now() >= *current->expires)
+        {
+            ++misses;
+            erase(current);
+
+            return std::nullopt;
+        }
+
+        ++hits;
+        entries.splice(entries.begin(), entries, current);
+
+        return current->value;
+    }
+
+    void cache::impl::insert(std::string key, std::string url, std::size_t stamp, response &value)
+    {
+        if (!cacheable(value))
+        {
+            return;
+        }
+
+        const auto size = footprint(value);
+
+        if (size > max_entry_size || size > max_size)
+        {
+            return;
+        }
+
+        // Views may point into memory the handler only guarantees for this request, so those are copied once.
+        // Everything else is shared between the cache and every response produced from it.
+
+        value.data = value.data.persist();
+
+        std::lock_guard guard{mutex};
+
+        if (stamp != generation)
+        {
+            return;
+        }
+
+        if (auto it = lookup.find(key); it != lookup.end())
+        {
+            used -= it->second->size;
+            entries.erase(it->second);
+            lookup.erase(it);
+        }
+
+        std::optional<clock::time_point> expires;
+
+        if (ttl.has_value())
+        {
+            expires.emplace(clock::now() + *ttl);
+        }
+
+        used += size;
+
+        entries.push_front({.key = key, .url = std::move(url), .value = value, .size = size, .expires = expires});
+        lookup.emplace(std::move(key), entries.begin());
+
+        while (used > max_size)
+        {
+            ++evictions;
+            erase(std::prev(entries.end()));
+        }
+    }
+
+    void cache::impl::clear()
+    {
+        lookup.clear();
+        entries.clear();
+        used = 0;
+    }
+
+    void cache::impl::erase(std::list<cached>::iterator it)
+    {
+        used -= it->size;
+        lookup.erase(it->key);
+        entries.erase(it);
+    }
+
+    std::shared_ptr<cache::impl> cache::make(resolver handler, const options &opts)
+    {
+        auto rtn = std::make_shared<impl>();
+
+        rtn->handler        = std::move(handler);
+        rtn->max_size       = opts.max_size;
+        rtn->max_entry_size = opts.max_entry_size;
+        rtn->ttl            = opts.ttl;
+        rtn->vary           = opts.vary;
+        rtn->methods        = opts.methods;
+
+        return rtn;
+    }
+
+    void cache::operator()(request req, executor exec) const
+    {
+        auto method = req.method();
+
+        if (!m_impl->methods.contains(method))
+        {
+            return m_impl->handler(std::move(req), std::move(exec));
+        }
+
+        auto url = req.url().string();
+        auto key = m_impl->key(req, method, url);
+
+        if (auto hit = m_impl->find(key); hit.has_value())
+        {
+            return exec.resolve(std::move(*hit));
+        }
+
+        auto [resolve, reject] = std::move(exec);
+        const auto generation  = m_impl->stamp();
+
+        auto store = [impl = m_impl, key = std::move(key), url = std::move(url), generation, resolve = std::move(resolve)](response value)
+        {
+            impl->insert(key, url, generation, value);
+            resolve(std::move(value));
+        };
+
+        return m_impl->handler(std::move(req), {.resolve = std::move(store), .reject = std::move(reject)});
+    }
+
+    cache::stats cache::metrics() const
+    {
+        std::lock_guard guard{m_impl->mutex};
+
+        return {
+            .hits      = m_impl->hits,
+            .misses    = m_impl->misses,
+            .evictions = m_impl->evictions,
+            .size      = m_impl->used,
+            .entries   = m_impl->entries.size(),
+        };
+    }
+
+    void cache::invalidate() const
+    {
+        std::lock_guard guard{m_impl->mutex};
+
+        m_impl->generation++;
+        m_impl->clear();
+    }
+
+    void cache::invalidate(const saucer::url &url) const
+    {
+        std::lock_guard guard{m_impl->mutex};
+
+        m_impl->generation++;
+        const auto target = url.string();
+
+        for (auto it = m_impl->entries.begin(); it != m_impl->entries.end();)
+        {
+            if (it->url != target)
+            {
+                ++it;
+                continue;
+            }
+
+            m_impl->erase(it++);
+        }
+    }
+} // namespace saucer::scheme
@@ -37,6 +37,11 @@ namespace saucer
         };
     }
 
+    pressure native::convert(unsigned long level)
+    {
+        return (level & DISPATCH_MEMORYPRESSURE_CRITICAL) ? pressure::critical : pressure::moderate;
+    }
+
     void native::init_menu()
     {
         const utils::autorelease_guard guard{};
@@ -1,5 +1,7 @@
 #include "cocoa.app.impl.hpp"
 
+#include "monitor.hpp"
+
 #include <algorithm>
 
 namespace saucer
@@ -21,10 +23,28 @@ namespace saucer
 
         native::init_menu();
 
+        static constexpr auto mask = DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL;
+        auto *const source         = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0, mask, dispatch_get_main_queue());
+
+        dispatch_source_set_event_handler(source, [this, source]
+                                          { utils::fire<event::memory>(events, native::convert(dispatch_source_get_data(source))); });
+
+        dispatch_resume(source);
+        platform->memory_source = source;
+
         return {};
     };
 
-    impl::~impl() = default;
+    impl::~impl()
+    {
+        if (!platform || !platform->memory_source)
+        {
+            return;
+        }
+
+        dispatch_source_cancel(platform->memory_source);
+        dispatch_release(platform->memory_source);
+    }
 
     std::vector<screen> impl::screens() const // NOLINT(*-static)
     {
@@ -42,7 +62,7 @@ namespace saucer
         return rtn;
     }
 
-    void application::post(post_callback_t callback) const // NOLINT(*-static)
+    void impl::schedule(post_callback_t callback) const // NOLINT(*-static)
     {
         auto *const queue = dispatch_get_main_queue();
         auto *const ptr   = new post_callback_t{std::move(callback)};
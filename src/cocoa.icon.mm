@@ -2,6 +2,7 @@
 
 #include "cocoa.utils.hpp"
 #include "error.impl.hpp"
+#include "handle.hpp"
 
 #include <cassert>
 
@@ -39,14 +40,77 @@ namespace saucer
 
     stash icon::data() const
     {
-        const utils::autorelease_guard guard{};
-
-        auto *const tiff = [m_impl->icon.get() TIFFRepresentation];
-        auto *const rep  = [NSBitmapImageRep imageRepWithData:tiff];
-        auto *const data = [rep representationUsingType:NSBitmapImageFileTypePNG properties:[NSDictionary dictionary]];
+        return m_impl->cache->encoded(
+            [image = m_impl->icon.get()]
+            {
+                const utils::autorelease_guard guard{};
+
+                auto *const tiff = [image TIFFRepresentation];
+                auto *const rep  = [NSBitmapImageRep imageRepWithData:tiff];
+                auto *const data = [rep representationUsingType:NSBitmapImageFileTypePNG properties:[NSDictionary dictionary]];
+
+                const auto *raw = reinterpret_cast<const std::uint8_t *>(data.bytes);
+                return stash::from({raw, raw + data.length});
+            });
+    }
 
-        const auto *raw = reinterpret_cast<const std::uint8_t *>(data.bytes);
-        return stash::from({raw, raw + data.length});
+    icon::bitmap icon::pixels() const
+    {
+        return m_impl->cache->decoded(
+            [image = m_impl->icon.get()]
+            {
+                using context_ptr = utils::handle<CGContextRef, CGContextRelease>;
+                using space_ptr   = utils::handle<CGColorSpaceRef, CGColorSpaceRelease>;
+
+                const utils::autorelease_guard guard{};
+
+                auto *const cg = [image CGImageForProposedRect:nullptr context:nil hints:nil];
+
+                if (!cg)
+                {
+                    return bitmap{};
+                }
+
+                const auto width  = CGImageGetWidth(cg);
+                const auto height = CGImageGetHeight(cg);
+                const auto stride = width * 4;
+
+                auto rtn          = std::vector<std::uint8_t>(stride * height);
+                const auto space  = space_ptr{CGColorSpaceCreateDeviceRGB()};
+                const auto format = kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big;
+
+                const auto context = context_ptr{CGBitmapContextCreate(rtn.data(), width, height, 8, stride, space.get(), format)};
+
+                if (!context.get())
+                {
+                    return bitmap{};
+                }
+
+                CGContextDrawImage(context.get(), CGRectMake(0, 0, width, height), cg);
+
+                // CoreGraphics only renders premultiplied alpha, which we undo to match the other backends.
+                for (auto it = rtn.begin(); it != rtn.end(); it += 4)
+                {
+                    const auto alpha = it[3];
+
+                    if (alpha == 0 || alpha == 255)
+                    {
+                        continue;
+                    }
+
+                    for (auto channel = 0; channel < 3; ++channel)
+                    {
+                        it[channel] = static_cast<std::uint8_t>(((it[channel] * 255) + (alpha / 2)) / alpha);
+                    }
+                }
+
+                return bitmap{
+                    .data   = stash::from(std::move(rtn)),
+                    .width  = width,
+                    .height = height,
+                    .stride = stride,
+                };
+            });
     }
 
     void icon::save(const fs::path &path) const
@@ -1,5 +1,7 @@
 #include "cocoa.window.impl.hpp"
 
+#include "monitor.hpp"
+
 #include "cocoa.app.impl.hpp"
 
 #include <algorithm>
@@ -21,7 +23,7 @@ namespace saucer
 
         const utils::objc_ptr<Observer> observer = [[Observer alloc] initWithCallback:[self]
                                                                      {
-                                                                         self->events.get<event::decorated>().fire(self->decorations());
+                                                                         utils::fire<event::decorated>(self->events, self->decorations());
                                                                      }];
 
         [window addObserver:observer.get() forKeyPath:@"styleMask" options:0 context:nullptr];
@@ -40,7 +42,7 @@ namespace saucer
 
         const utils::objc_ptr<Observer> observer = [[Observer alloc] initWithCallback:[self]
                                                                      {
-                                                                         self->events.get<event::maximize>().fire(self->maximized());
+                                                                         utils::fire<event::maximize>(self->events, self->maximized());
                                                                      }];
 
         [window addObserver:observer.get() forKeyPath:@"isZoomed" options:0 context:nullptr];
@@ -198,33 +200,38 @@ using namespace saucer;
 
 - (void)windowDidMiniaturize:(NSNotification *)notification
 {
-    me->events.get<event::minimize>().fire(true);
+    utils::fire<event::minimize>(me->events, true);
 }
 
 - (void)windowDidDeminiaturize:(NSNotification *)notification
 {
-    me->events.get<event::minimize>().fire(false);
+    utils::fire<event::minimize>(me->events, false);
 }
 
 - (void)windowDidResize:(NSNotification *)notification
 {
     const auto [width, height] = me->size();
-    me->events.get<event::resize>().fire(width, height);
+    utils::fire<event::resize>(me->events, width, height);
+}
+
+- (void)windowDidMove:(NSNotification *)notification
+{
+    me->refresh();
 }
 
 - (void)windowDidBecomeKey:(NSNotification *)notification
 {
-    me->events.get<event::focus>().fire(true);
+    utils::fire<event::focus>(me->events, true);
 }
 
 - (void)windowDidResignKey:(NSNotification *)notification
 {
-    me->events.get<event::focus>().fire(false);
+    utils::fire<event::focus>(me->events, false);
 }
 
 - (BOOL)windowShouldClose:(NSWindow *)sender
 {
-    if (me->events.get<event::close>().fire().find(policy::block))
+    if (utils::fire<event::close>(me->events).find(policy::block))
     {
         return false;
     }
@@ -238,7 +245,7 @@ using namespace saucer;
     me->hide();
 
     instances.erase(identifier);
-    me->events.get<event::closed>().fire();
+    utils::fire<event::closed>(me->events);
 
     if (!impl->quit_on_last_window_closed)
     {
@@ -0,0 +1,31 @@
+#include "context.impl.hpp"
+
+#include "error.impl.hpp"
+
+#include "app.hpp"
+
+namespace saucer
+{
+    context::context(std::shared_ptr<impl> impl) : m_impl(std::move(impl)) {}
+
+    result<context> context::create(application *parent, const options &opts)
+    {
+        if (!parent->thread_safe())
+        {
+            return parent->invoke(&context::create, parent, opts);
+        }
+
+        // Native sessions have to be released on the main thread, no matter which webview or copy lets go of them last.
+        auto rtn = std::shared_ptr<impl>{new impl, detail::safe_delete<impl>{parent}};
+
+        rtn->parent = parent;
+        rtn->opts   = opts;
+
+        if (auto status = rtn->init_platform(); !status.has_value())
+        {
+            return err(status);
+        }
+
+        return context{std::move(rtn)};
+    }
+} // namespace saucer
@@ -0,0 +1,511 @@
+#include "scheme/directory.hpp"
+
+#include "mime.hpp"
+#include "mapping.hpp"
+
+#include <list>
+#include <mutex>
+#include <fstream>
+#include <optional>
+#include <expected>
+#include <unordered_map>
+
+#ifdef __linux__
+#include "handle.hpp"
+
+#include <unistd.h>
+#include <sys/inotify.h>
+#endif
+
+namespace saucer::scheme
+{
+    struct entry
+    {
+        fs::path key;
+        fs::path file;
+
+      public:
+        stash content;
+        std::string mime;
+
+      public:
+        std::size_t size;
+        fs::file_time_type modified;
+    };
+
+#ifdef __linux__
+    class watcher
+    {
+        static constexpr auto mask = IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                     IN_DELETE_SELF | IN_MOVE_SELF;
+
+      private:
+        utils::handle<int, ::close, -1> m_fd;
+        std::unordered_map<int, fs::path> m_watches;
+        std::unordered_map<fs::path, int> m_descriptors;
+
+      public:
+        watcher() : m_fd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) {}
+
+      public:
+        [[nodiscard]] bool valid() const
+        {
+            return m_fd.get() != -1;
+        }
+
+      public:
+        void watch(const fs::path &directory)
+        {
+            const auto wd = inotify_add_watch(m_fd.get(), directory.c_str(), mask);
+
+            if (wd == -1)
+            {
+                return;
+            }
+
+            m_watches.emplace(wd, directory);
+            m_descriptors.emplace(directory, wd);
+        }
+
+        void unwatch(const fs::path &directory)
+        {
+            const auto it = m_descriptors.find(directory);
+
+            if (it == m_descriptors.end())
+            {
+                return;
+            }
+
+            inotify_rm_watch(m_fd.get(), it->second);
+
+            m_watches.erase(it->second);
+            m_descriptors.erase(it);
+        }
+
+        template <typename Callback>
+        void poll(Callback &&callback)
+        {
+            alignas(inotify_event) char buffer[4096];
+            ssize_t length{};
+
+            // The descriptor is non-blocking, so this only drains what has piled up since the last request.
+            while ((length = read(m_fd.get(), buffer, sizeof(buffer))) > 0)
+            {
+                for (const char *it = buffer; it < buffer + length;)
+                {
+                    const auto *event = reinterpret_cast<const inotify_event *>(it);
+                    it += sizeof(inotify_event) + event->len;
+
+                    if (event->mask & IN_Q_OVERFLOW)
+                    {
+                        callback(std::nullopt);
+                        continue;
+                    }
+
+                    if (event->mask & IN_IGNORED)
+                    {
+                        if (const auto it = m_watches.find(event->wd); it != m_watches.end())
+                        {
+                            m_descriptors.erase(it->second);
+                            m_watches.erase(it);
+                        }
+
+                        continue;
+                    }
+
+                    const auto directory = m_watches.find(event->wd);
+
+                    if (directory == m_watches.end())
+                    {
+                        continue;
+                    }
+
+                    callback(event->len > 0 ? directory->second / event->name : directory->second);
+                }
+            }
+        }
+    };
+#endif
+
+    static bool affects(const fs::path &file, const fs::path &changed)
+    {
+        return file == changed || file.parent_path() == changed;
+    }
+
+    struct directory::impl
+    {
+        fs::path root;
+        std::string index;
+
+      public:
+        std::size_t cache_size;
+        std::optional<std::size_t> map_threshold;
+
+      public:
+        std::mutex mutex;
+        std::size_t used{0};
+
+      public:
+        std::list<entry> entries;
+        std::unordered_map<fs::path, std::list<entry>::iterator> lookup;
+
+#ifdef __linux__
+      public:
+        std::optional<watcher> notifier;
+        std::unordered_map<fs::path, std::size_t> watched;
+#endif
+
+      public:
+        [[nodiscard]] bool watching() const;
+        [[nodiscard]] bool valid(const entry &) const;
+
+      public:
+        [[nodiscard]] std::optional<fs::path> locate(const saucer::url &) const;
+        [[nodiscard]] fs::path resolve(const fs::path &) const;
+        [[nodiscard]] std::expected<entry, error> load(const fs::path &) const;
+
+      public:
+        std::expected<response, error> fetch(const fs::path &);
+
+      public:
+        void watch(const fs::path &);
+        void unwatch(const fs::path &);
+
+      public:
+        bool poll(const std::optional<fs::path> & = std::nullopt);
+        void insert(entry);
+
+      public:
+        void clear();
+        void erase(std::list<entry>::iterator);
+        void erase(const fs::path &);
+    };
+
+    bool directory::impl::watching() const
+    {
+#ifdef __linux__
+        return notifier.has_value();
+#else
+        return false;
+#endif
+    }
+
+    bool directory::impl::valid(const entry &entry) const
+    {
+        // Without a file-system watcher (be it disabled or unavailable) we fall back to a single `stat` per cache hit.
+
+        if (watching())
+        {
+            return true;
+        }
+
+        std::error_code ec{};
+
+        const auto size     = fs::file_size(entry.file, ec);
+        const auto modified = fs::last_write_time(entry.file, ec);
+
+        return !ec && size == entry.size && modified == entry.modified;
+    }
+
+    std::optional<fs::path> directory::impl::locate(const saucer::url &url) const
+    {
+        auto rtn = url.path().relative_path().lexically_normal();
+
+        if (!rtn.empty() && *rtn.begin() == "..")
+        {
+            return std::nullopt;
+        }
+
+        return rtn;
+    }
+
+    fs::path directory::impl::resolve(const fs::path &key) const
+    {
+        auto rtn = root / key;
+        auto ec  = std::error_code{};
+
+        if (fs::is_directory(rtn, ec))
+        {
+            rtn /= index;
+        }
+
+        return rtn.lexically_normal();
+    }
+
+    std::expected<entry, error> directory::impl::load(const fs::path &key) const
+    {
+        auto file = resolve(key);
+        auto ec   = std::error_code{};
+
+        if (!fs::is_regular_file(file, ec))
+        {
+            return std::unexpected{error::not_found};
+        }
+
+        const auto size     = fs::file_size(file, ec);
+        const auto modified = fs::last_write_time(file, ec);
+
+        if (ec)
+        {
+            return std::unexpected{error::failed};
+        }
+
+        auto content = stash::empty();
+
+        if (map_threshold.has_value() && size >= *map_threshold)
+        {
+            auto mapped = utils::mapping::map(file);
+
+            if (!mapped.has_value())
+            {
+                return std::unexpected{error::failed};
+            }
+
+            auto owner = std::make_shared<const utils::mapping>(std::move(*mapped));
+            content    = stash::share(owner, owner->data());
+        }
+        else
+        {
+            auto buffer = std::vector<std::uint8_t>(size);
+            auto stream = std::ifstream{file, std::ios::binary};
+
+            if (!stream.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(size)))
+            {
+                return std::unexpected{error::failed};
+            }
+
+            content = stash::from(std::move(buffer));
+        }
+
+        auto mime = utils::mime(file, {content.data(), content.size()});
+
+        return entry{
+            .key      = key,
+            .file     = std::move(file),
+            .content  = std::move(content),
+            .mime     = std::move(mime),
+            .size     = size,
+            .modified = modified,
+        };
+    }
+
+    std::expected<response, error> directory::impl::fetch(const fs::path &key)
+    {
+        std::lock_guard guard{mutex};
+
+        poll();
+
+        if (auto it = lookup.find(key); it != lookup.end())
+        {
+            auto current = it->second;
+
+            if (valid(*current))
+            {
+                entries.splice(entries.begin(), entries, current);
+                return response{.data = current->content, .mime = current->mime};
+            }
+
+            erase(current);
+        }
+
+        // The directory is watched before the file is read, so that a write in between is not missed.
+        const auto parent = resolve(key).parent_path();
+        watch(parent);
+
+        auto loaded = load(key);
+
+        if (!loaded.has_value())
+        {
+            unwatch(parent);
+            return std::unexpected{loaded.error()};
+        }
+
+        auto rtn = response{.data = loaded->content, .mime = loaded->mime};
+
+        // A change that happened while reading may have left us with outdated content, it is served but not cached.
+        if (!poll(loaded->file))
+        {
+            insert(std::move(*loaded));
+        }
+
+        unwatch(parent);
+
+        return rtn;
+    }
+
+    void directory::impl::watch([[maybe_unused]] const fs::path &directory)
+    {
+#ifdef __linux__
+        if (!notifier.has_value())
+        {
+            return;
+        }
+
+        if (watched[directory]++ == 0)
+        {
+            notifier->watch(directory);
+        }
+#endif
+    }
+
+    void directory::impl::unwatch([[maybe_unused]] const fs::path &directory)
+    {
+#ifdef __linux__
+        if (!notifier.has_value())
+        {
+            return;
+        }
+
+        const auto it = watched.find(directory);
+
+        if (it == watched.end() || --it->second > 0)
+        {
+            return;
+        }
+
+        notifier->unwatch(directory);
+        watched.erase(it);
+#endif
+    }
+
+    bool directory::impl::poll([[maybe_unused]] const std::optional<fs::path> &pending)
+    {
+        // Returns whether the `pending` file (which is not cached yet) was affected by any of the changes.
+
+        auto rtn = false;
+
+#ifdef __linux__
+        if (!notifier.has_value())
+        {
+            return rtn;
+        }
+
+        notifier->poll(
+            [this, &pending, &rtn](const std::optional<fs::path> &changed)
+            {
+                if (!changed.has_value())
+                {
+                    rtn = true;
+                    return clear();
+                }
+
+                if (pending.has_value())
+                {
+                    rtn |= affects(*pending, *changed);
+                }
+
+                return erase(*changed);
+            });
+#endif
+
+        return rtn;
+    }
+
+    void directory::impl::insert(entry value)
+    {
+        if (value.size > cache_size)
+        {
+            return;
+        }
+
+        watch(value.file.parent_path());
+
+        used += value.size;
+        auto key = value.key;
+
+        entries.emplace_front(std::move(value));
+        lookup.emplace(std::move(key), entries.begin());
+
+        while (used > cache_size)
+        {
+            erase(std::prev(entries.end()));
+        }
+    }
+
+    void directory::impl::clear()
+    {
+        while (!entries.empty())
+        {
+            erase(entries.begin());
+        }
+    }
+
+    void directory::impl::erase(std::list<entry>::iterator it)
+    {
+        const auto parent = it->file.parent_path();
+
+        used -= it->size;
+        lookup.erase(it->key);
+        entries.erase(it);
+
+        unwatch(parent);
+    }
+
+    void directory::impl::erase(const fs::path &path)
+    {
+        const auto normalized = path.lexically_normal();
+
+        for (auto it = entries.begin(); it != entries.end();)
+        {
+            if (!affects(it->file, normalized))
+            {
+                ++it;
+                continue;
+            }
+
+            erase(it++);
+        }
+    }
+
+    directory::directory(const options &opts) : m_impl(std::make_shared<impl>())
+    {
+        m_impl->root          = fs::absolute(opts.root.value()).lexically_normal();
+        m_impl->index         = opts.index;
+        m_impl->cache_size    = opts.cache_size;
+        m_impl->map_threshold = opts.map_threshold;
+
+#ifdef __linux__
+        if (!opts.watch)
+        {
+            return;
+        }
+
+        if (auto notifier = watcher{}; notifier.valid())
+        {
+            m_impl->notifier.emplace(std::move(notifier));
+        }
+#endif
+    }
+
+    void directory::operator()(const request &request, const executor &exec) const
+    {
+        const auto &[resolve, reject] = exec;
+        const auto key                = m_impl->locate(request.url());
+
+        if (!key.has_value())
+        {
+            return reject(error::invalid);
+        }
+
+        auto response = m_impl->fetch(*key);
+
+        if (!response.has_value())
+        {
+            return reject(response.error());
+        }
+
+        return resolve(std::move(*response));
+    }
+
+    void directory::invalidate() const
+    {
+        std::lock_guard guard{m_impl->mutex};
+        m_impl->clear();
+    }
+
+    void directory::invalidate(const fs::path &path) const
+    {
+        std::lock_guard guard{m_impl->mutex};
+        m_impl->erase(path.is_absolute() ? path : m_impl->root / path);
+    }
+} // namespace saucer::scheme
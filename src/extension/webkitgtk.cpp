@@ -0,0 +1,17 @@
+#include <unistd.h>
+
+#include <webkit/webkit-web-process-extension.h>
+
+// Loaded into every web process of a saucer webview. WebKitGtk has no public api to retrieve the identifier of a web process,
+// so each page reports it to its webview instead.
+
+static void on_page(WebKitWebProcessExtension *, WebKitWebPage *page, gpointer)
+{
+    auto *const message = webkit_user_message_new("saucer:pid", g_variant_new_uint32(static_cast<guint32>(getpid())));
+    webkit_web_page_send_message_to_view(page, message, nullptr, nullptr, nullptr);
+}
+
+extern "C" G_MODULE_EXPORT void webkit_web_process_extension_initialize(WebKitWebProcessExtension *extension)
+{
+    g_signal_connect(extension, "page-created", G_CALLBACK(on_page), nullptr);
+}
@@ -1,5 +1,7 @@
 #include "gtk.app.impl.hpp"
 
+#include "monitor.hpp"
+
 #include <format>
 
 namespace saucer
@@ -31,11 +33,28 @@ namespace saucer
             g_application_hold(G_APPLICATION(platform->application.get()));
         }
 
+        auto warning = [](GMemoryMonitor *, GMemoryMonitorWarningLevel level, impl *self)
+        {
+            utils::fire<event::memory>(self->events, native::convert(level));
+        };
+
+        platform->memory_monitor = g_memory_monitor_dup_default();
+        platform->memory_warning = utils::connect(platform->memory_monitor.get(), "low-memory-warning", +warning, this);
+
         return {};
     }
 
     // We don't need to call `g_application_release` anymore as we're explicitly calling quit
-    impl::~impl() = default;
+    impl::~impl()
+    {
+        if (!platform || !platform->memory_monitor)
+        {
+            return;
+        }
+
+        // The monitor is a process-wide singleton that may outlive us.
+        g_signal_handler_disconnect(platform->memory_monitor.get(), platform->memory_warning);
+    }
 
     std::vector<screen> impl::screens() const // NOLINT(*-static)
     {
@@ -55,7 +74,7 @@ namespace saucer
         return rtn;
     }
 
-    void application::post(post_callback_t callback) const // NOLINT(*-static)
+    void impl::schedule(post_callback_t callback) const // NOLINT(*-static)
     {
         auto once = [](post_callback_t *data)
         {
@@ -26,6 +26,11 @@ namespace saucer
         };
     }
 
+    pressure native::convert(GMemoryMonitorWarningLevel level)
+    {
+        return level >= G_MEMORY_MONITOR_WARNING_LEVEL_CRITICAL ? pressure::critical : pressure::moderate;
+    }
+
     std::string native::fix_id(const std::string &id)
     {
         return id                                                                                            //
@@ -36,6 +36,16 @@ namespace saucer
         return !m_impl->texture;
     }
 
+    static stash share(GBytes *bytes)
+    {
+        auto owner = std::make_shared<const utils::g_bytes_ptr>(bytes);
+
+        gsize size{};
+        const auto *data = reinterpret_cast<const std::uint8_t *>(g_bytes_get_data(owner->get(), &size));
+
+        return stash::share(std::move(owner), {data, size});
+    }
+
     stash icon::data() const
     {
         if (!m_impl->texture)
@@ -43,12 +53,35 @@ namespace saucer
             return stash::empty();
         }
 
-        const auto bytes = utils::g_bytes_ptr{gdk_texture_save_to_png_bytes(m_impl->texture.get())};
+        return m_impl->cache->encoded([texture = m_impl->texture.get()] { return share(gdk_texture_save_to_png_bytes(texture)); });
+    }
 
-        gsize size{};
-        const auto *data = reinterpret_cast<const std::uint8_t *>(g_bytes_get_data(bytes.get(), &size));
+    icon::bitmap icon::pixels() const
+    {
+        if (!m_impl->texture)
+        {
+            return {};
+        }
 
-        return stash::from({data, data + size});
+        return m_impl->cache->decoded(
+            [texture = m_impl->texture.get()]
+            {
+                using downloader_ptr  = utils::handle<GdkTextureDownloader *, gdk_texture_downloader_free>;
+                const auto downloader = downloader_ptr{gdk_texture_downloader_new(texture)};
+
+                gdk_texture_downloader_set_format(downloader.get(), GDK_MEMORY_R8G8B8A8);
+
+                // When the texture is already stored as RGBA this hands out a reference to its memory instead of a copy.
+                gsize stride{};
+                auto data = share(gdk_texture_downloader_download_bytes(downloader.get(), &stride));
+
+                return bitmap{
+                    .data   = std::move(data),
+                    .width  = static_cast<std::size_t>(gdk_texture_get_width(texture)),
+                    .height = static_cast<std::size_t>(gdk_texture_get_height(texture)),
+                    .stride = stride,
+                };
+            });
     }
 
     void icon::save(const fs::path &path) const
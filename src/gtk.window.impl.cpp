@@ -1,5 +1,7 @@
 #include "gtk.window.impl.hpp"
 
+#include "monitor.hpp"
+
 #include "gtk.app.impl.hpp"
 
 #include <algorithm>
@@ -56,7 +58,7 @@ namespace saucer
         auto callback = [](void *, GParamSpec *, impl *self)
         {
             auto [width, height] = self->size();
-            self->events.get<event::resize>().fire(width, height);
+            utils::fire<event::resize>(self->events, width, height);
         };
 
         const auto width  = utils::connect(window.get(), "notify::default-width", +callback, self);
@@ -82,7 +84,7 @@ namespace saucer
 
         auto callback = [](void *, GParamSpec *, impl *self)
         {
-            self->events.get<event::maximize>().fire(self->maximized());
+            utils::fire<event::maximize>(self->events, self->maximized());
         };
 
         const auto id = utils::connect(window.get(), "notify::maximized", +callback, self);
@@ -106,7 +108,7 @@ namespace saucer
 
         auto callback = [](void *, GParamSpec *, impl *self)
         {
-            self->events.get<event::focus>().fire(self->focused());
+            utils::fire<event::focus>(self->events, self->focused());
         };
 
         const auto id = utils::connect(window.get(), "notify::is-active", +callback, self);
@@ -165,7 +167,7 @@ namespace saucer
     {
         auto callback = [](void *, impl *self) -> gboolean
         {
-            if (self->events.get<event::close>().fire().find(policy::block))
+            if (utils::fire<event::close>(self->events).find(policy::block))
             {
                 return true;
             }
@@ -177,7 +179,7 @@ namespace saucer
             auto &instances  = impl->instances;
 
             instances.erase(identifier);
-            self->events.get<event::closed>().fire();
+            utils::fire<event::closed>(self->events);
 
             if (!impl->quit_on_last_window_closed)
             {
@@ -273,7 +275,7 @@ namespace saucer
             }
 
             prev.emplace(current);
-            self->events.get<event::decorated>().fire(current);
+            utils::fire<event::decorated>(self->events, current);
         };
 
         auto fullscreen = [](void *, GParamSpec *, impl *self)
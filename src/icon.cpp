@@ -0,0 +1,155 @@
+#include "icon.hpp"
+
+#include "workers.hpp"
+#include "error.impl.hpp"
+
+#include <map>
+#include <list>
+#include <mutex>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <utility>
+#include <functional>
+#include <string_view>
+
+namespace saucer
+{
+    struct decoder
+    {
+        // Entries are keyed on the hash and size of the encoded content, the bytes themselves are not kept around.
+        using key = std::pair<std::size_t, std::size_t>;
+
+      public:
+        struct entry
+        {
+            key id;
+            icon value;
+        };
+
+      public:
+        static constexpr std::size_t capacity = 64;
+
+      public:
+        std::mutex cache_mutex;
+        std::list<entry> recent;
+        std::map<key, std::list<entry>::iterator> cache;
+
+      public:
+        template <typename Callback>
+        result<icon> lookup(const stash &, Callback &&);
+
+      public:
+        static decoder &instance();
+    };
+
+    template <typename Callback>
+    result<icon> decoder::lookup(const stash &content, Callback &&decode)
+    {
+        const auto view = std::string_view{reinterpret_cast<const char *>(content.data()), content.size()};
+        const auto id   = key{std::hash<std::string_view>{}(view), content.size()};
+
+        {
+            std::lock_guard guard{cache_mutex};
+
+            if (auto it = cache.find(id); it != cache.end())
+            {
+                recent.splice(recent.begin(), recent, it->second);
+                return it->second->value;
+            }
+        }
+
+        auto rtn = std::invoke(std::forward<Callback>(decode));
+
+        if (!rtn.has_value())
+        {
+            return rtn;
+        }
+
+        std::lock_guard guard{cache_mutex};
+
+        if (cache.contains(id))
+        {
+            return rtn;
+        }
+
+        recent.push_front({.id = id, .value = rtn.value()});
+        cache.emplace(id, recent.begin());
+
+        // The least recently used icon is evicted once the cache is full
+        while (recent.size() > capacity)
+        {
+            cache.erase(recent.back().id);
+            recent.pop_back();
+        }
+
+        return rtn;
+    }
+
+    decoder &decoder::instance()
+    {
+        static decoder rtn;
+        return rtn;
+    }
+
+    coco::future<result<icon>> icon::from_async(stash ico, caching mode)
+    {
+        auto promise = coco::promise<result<icon>>{};
+        auto rtn     = promise.get_future();
+
+        auto task = [promise = std::move(promise), ico = ico.persist(), mode]() mutable
+        {
+            if (mode == caching::none)
+            {
+                return promise.set_value(from(ico));
+            }
+
+            return promise.set_value(decoder::instance().lookup(ico, [&ico] { return from(ico); }));
+        };
+
+        utils::workers::shared().submit(std::move(task));
+
+        return rtn;
+    }
+
+    coco::future<result<icon>> icon::from_async(fs::path file, caching mode)
+    {
+        auto promise = coco::promise<result<icon>>{};
+        auto rtn     = promise.get_future();
+
+        auto task = [promise = std::move(promise), file = std::move(file), mode]() mutable
+        {
+            if (mode == caching::none)
+            {
+                return promise.set_value(from(file));
+            }
+
+            // The file is read instead of mapped, a mapping would fault (SIGBUS) if the file was truncated while decoding.
+            auto stream = std::ifstream{file, std::ios::binary};
+
+            if (!stream)
+            {
+                return promise.set_value(result<icon>{err(std::errc::io_error)});
+            }
+
+            auto buffer  = std::vector<std::uint8_t>(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+            auto content = stash::from(std::move(buffer));
+
+            return promise.set_value(decoder::instance().lookup(content, [&content] { return from(content); }));
+        };
+
+        utils::workers::shared().submit(std::move(task));
+
+        return rtn;
+    }
+
+    void icon::purge()
+    {
+        auto &global = decoder::instance();
+
+        std::lock_guard guard{global.cache_mutex};
+
+        global.cache.clear();
+        global.recent.clear();
+    }
+} // namespace saucer
@@ -0,0 +1,120 @@
+#include "instrumentation.hpp"
+
+#include <mutex>
+#include <utility>
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+namespace saucer::instrumentation
+{
+    struct stats
+    {
+        std::size_t calls{0};
+
+      public:
+        clock::duration queued{};
+        clock::duration executed{};
+
+      public:
+        clock::duration max_queued{};
+        clock::duration max_executed{};
+    };
+
+    struct registry
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string_view, stats> sites;
+
+      public:
+        static registry &instance();
+    };
+
+    static constexpr auto fallback = "saucer::application::invoke";
+    static thread_local const char *active{nullptr};
+
+    registry &registry::instance()
+    {
+        static registry rtn;
+        return rtn;
+    }
+
+    scope::scope(const char *site) : m_previous(std::exchange(active, site)) {}
+
+    scope::~scope()
+    {
+        active = m_previous;
+    }
+
+    const char *scope::current()
+    {
+        return active;
+    }
+
+    probe::probe(const char *site) : m_site(site ? site : fallback), m_posted(clock::now()) {}
+
+    void probe::start()
+    {
+        m_started = clock::now();
+    }
+
+    void probe::finish() const
+    {
+        const auto queued   = m_started - m_posted;
+        const auto executed = clock::now() - m_started;
+
+        auto &global = registry::instance();
+        std::lock_guard guard{global.mutex};
+
+        // Sites are either string literals or names baked into the binary, so keying on a view is safe.
+        auto &entry = global.sites[m_site];
+
+        entry.calls++;
+        entry.queued += queued;
+        entry.executed += executed;
+        entry.max_queued   = std::max(entry.max_queued, queued);
+        entry.max_executed = std::max(entry.max_executed, executed);
+    }
+
+    bool enabled()
+    {
+#ifdef SAUCER_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::vector<hop> snapshot()
+    {
+        auto &global = registry::instance();
+        std::lock_guard guard{global.mutex};
+
+        std::vector<hop> rtn;
+        rtn.reserve(global.sites.size());
+
+        for (const auto &[site, value] : global.sites)
+        {
+            rtn.emplace_back(hop{
+                .site         = std::string{site},
+                .calls        = value.calls,
+                .queued       = value.queued,
+                .executed     = value.executed,
+                .max_queued   = value.max_queued,
+                .max_executed = value.max_executed,
+            });
+        }
+
+        std::ranges::sort(rtn, std::greater{}, [](const auto &hop) { return hop.queued + hop.executed; });
+
+        return rtn;
+    }
+
+    void reset()
+    {
+        auto &global = registry::instance();
+        std::lock_guard guard{global.mutex};
+
+        global.sites.clear();
+    }
+} // namespace saucer::instrumentation
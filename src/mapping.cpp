@@ -0,0 +1,148 @@
+#include "mapping.hpp"
+
+#include "error.impl.hpp"
+
+#include <cerrno>
+#include <utility>
+#include <system_error>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace saucer::utils
+{
+    mapping::mapping() = default;
+
+    mapping::mapping(void *data, std::size_t size) : m_data(data), m_size(size) {}
+
+    mapping::mapping(mapping &&other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0))
+    {
+    }
+
+    mapping &mapping::operator=(mapping &&other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+        }
+
+        return *this;
+    }
+
+    mapping::~mapping()
+    {
+        if (!m_data)
+        {
+            return;
+        }
+
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap(m_data, m_size);
+#endif
+    }
+
+    std::size_t mapping::size() const
+    {
+        return m_size;
+    }
+
+    std::span<const std::uint8_t> mapping::data() const
+    {
+        return {reinterpret_cast<const std::uint8_t *>(m_data), m_size};
+    }
+
+#ifdef _WIN32
+    result<mapping> mapping::map(const fs::path &file)
+    {
+        auto *const handle = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                         OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (handle == INVALID_HANDLE_VALUE)
+        {
+            return err(std::error_code{static_cast<int>(GetLastError()), std::system_category()});
+        }
+
+        LARGE_INTEGER size{};
+
+        if (!GetFileSizeEx(handle, &size))
+        {
+            const auto error = GetLastError();
+            CloseHandle(handle);
+            return err(std::error_code{static_cast<int>(error), std::system_category()});
+        }
+
+        if (size.QuadPart == 0)
+        {
+            CloseHandle(handle);
+            return mapping{};
+        }
+
+        auto *const section = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(handle);
+
+        if (!section)
+        {
+            return err(std::error_code{static_cast<int>(GetLastError()), std::system_category()});
+        }
+
+        // The view keeps the section alive, so we can close the handle right away.
+        auto *const view = MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(section);
+
+        if (!view)
+        {
+            return err(std::error_code{static_cast<int>(GetLastError()), std::system_category()});
+        }
+
+        return mapping{view, static_cast<std::size_t>(size.QuadPart)};
+    }
+#else
+    result<mapping> mapping::map(const fs::path &file)
+    {
+        const auto fd = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd == -1)
+        {
+            return err(std::error_code{errno, std::system_category()});
+        }
+
+        struct stat info{};
+
+        if (fstat(fd, &info) == -1)
+        {
+            const auto error = errno;
+            close(fd);
+            return err(std::error_code{error, std::system_category()});
+        }
+
+        if (info.st_size == 0)
+        {
+            close(fd);
+            return mapping{};
+        }
+
+        const auto size  = static_cast<std::size_t>(info.st_size);
+        auto *const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // The mapping keeps a reference to the file, so we can close the descriptor right away.
+        close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            return err(std::error_code{errno, std::system_category()});
+        }
+
+        return mapping{data, size};
+    }
+#endif
+} // namespace saucer::utils
@@ -0,0 +1,148 @@
+#include "mime.hpp"
+
+#include <array>
+#include <cctype>
+#include <ranges>
+#include <algorithm>
+
+#include <string_view>
+
+namespace saucer::utils
+{
+    using namespace std::string_view_literals;
+
+    struct extension
+    {
+        std::string_view name;
+        std::string_view mime;
+    };
+
+    struct signature
+    {
+        std::string_view magic;
+        std::string_view mime;
+    };
+
+    static constexpr auto extensions = std::to_array<extension>({
+        {".html", "text/html"},
+        {".htm", "text/html"},
+        {".css", "text/css"},
+        {".js", "text/javascript"},
+        {".mjs", "text/javascript"},
+        {".json", "application/json"},
+        {".map", "application/json"},
+        {".wasm", "application/wasm"},
+        {".txt", "text/plain"},
+        {".md", "text/markdown"},
+        {".xml", "application/xml"},
+        {".csv", "text/csv"},
+        {".svg", "image/svg+xml"},
+        {".png", "image/png"},
+        {".jpg", "image/jpeg"},
+        {".jpeg", "image/jpeg"},
+        {".gif", "image/gif"},
+        {".webp", "image/webp"},
+        {".avif", "image/avif"},
+        {".ico", "image/x-icon"},
+        {".bmp", "image/bmp"},
+        {".woff", "font/woff"},
+        {".woff2", "font/woff2"},
+        {".ttf", "font/ttf"},
+        {".otf", "font/otf"},
+        {".mp3", "audio/mpeg"},
+        {".ogg", "audio/ogg"},
+        {".wav", "audio/wav"},
+        {".mp4", "video/mp4"},
+        {".webm", "video/webm"},
+        {".pdf", "application/pdf"},
+        {".zip", "application/zip"},
+    });
+
+    static constexpr auto signatures = std::to_array<signature>({
+        {"\x89PNG\r\n\x1a\n"sv, "image/png"},
+        {"\xff\xd8\xff"sv, "image/jpeg"},
+        {"GIF87a"sv, "image/gif"},
+        {"GIF89a"sv, "image/gif"},
+        {"%PDF-"sv, "application/pdf"},
+        {"\0asm"sv, "application/wasm"},
+        {"wOFF"sv, "font/woff"},
+        {"wOF2"sv, "font/woff2"},
+        {"PK\x03\x04"sv, "application/zip"},
+        {"\x1a\x45\xdf\xa3"sv, "video/webm"},
+        {"OggS"sv, "audio/ogg"},
+        {"ID3"sv, "audio/mpeg"},
+    });
+
+    static std::string lower(std::string_view value)
+    {
+        auto transform = [](const unsigned char c)
+        {
+            return static_cast<char>(std::tolower(c));
+        };
+
+        return value                             //
+               | std::views::transform(transform) //
+               | std::ranges::to<std::string>();
+    }
+
+    static std::string_view sniff(std::span<const std::uint8_t> data)
+    {
+        const auto content = std::string_view{reinterpret_cast<const char *>(data.data()), data.size()};
+
+        for (const auto &[magic, mime] : signatures)
+        {
+            if (!content.starts_with(magic))
+            {
+                continue;
+            }
+
+            return mime;
+        }
+
+        if (content.size() >= 12 && content.substr(0, 4) == "RIFF" && content.substr(8, 4) == "WEBP")
+        {
+            return "image/webp";
+        }
+
+        const auto start = content.find_first_not_of(" \t\r\n");
+
+        if (start == std::string_view::npos)
+        {
+            return "text/plain";
+        }
+
+        const auto head = lower(content.substr(start, 64));
+
+        if (head.starts_with("<!doctype html") || head.starts_with("<html") || head.starts_with("<head") || head.starts_with("<body"))
+        {
+            return "text/html";
+        }
+
+        if (head.starts_with("<svg"))
+        {
+            return "image/svg+xml";
+        }
+
+        if (head.starts_with("<?xml"))
+        {
+            return "application/xml";
+        }
+
+        const auto binary = std::ranges::any_of(content.substr(0, 512), [](const char c) { return static_cast<unsigned char>(c) < 0x09; });
+
+        return binary ? "application/octet-stream" : "text/plain";
+    }
+
+    std::string mime(const fs::path &file, std::span<const std::uint8_t> data)
+    {
+        const auto ext = lower(file.extension().string());
+        const auto it   = std::ranges::find(extensions, ext, &extension::name);
+
+        if (it != extensions.end())
+        {
+            return std::string{it->mime};
+        }
+
+        return std::string{sniff(data)};
+    }
+} // namespace saucer::utils
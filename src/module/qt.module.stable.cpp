@@ -5,6 +5,7 @@
 #include "qt.window.impl.hpp"
 
 #include "qt.url.impl.hpp"
+#include "qt.context.impl.hpp"
 #include "qt.webview.impl.hpp"
 #include "qt.permission.impl.hpp"
 
@@ -43,6 +44,12 @@ namespace saucer
     template <>
     natives<icon, true> icon::native<true>() const
     {
-        return {.icon = m_impl->icon};
+        return {.icon = m_impl->get()};
+    }
+
+    template <>
+    natives<context, true> context::native<true>() const
+    {
+        return {.profile = m_impl->platform->profile.get()};
     }
 } // namespace saucer
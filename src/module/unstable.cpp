@@ -1,6 +1,7 @@
 #include "app.hpp"
 #include "window.hpp"
 #include "webview.hpp"
+#include "context.hpp"
 
 namespace saucer
 {
@@ -39,4 +40,10 @@ namespace saucer
     {
         return m_impl.get();
     }
+
+    template <>
+    natives<context, false> context::native<false>() const
+    {
+        return m_impl.get();
+    }
 } // namespace saucer
@@ -5,6 +5,7 @@
 #include "cocoa.window.impl.hpp"
 
 #include "wk.url.impl.hpp"
+#include "wk.context.impl.hpp"
 #include "wk.webview.impl.hpp"
 #include "wk.permission.impl.hpp"
 
@@ -45,4 +46,10 @@ namespace saucer
     {
         return {.icon = m_impl->icon.get()};
     }
+
+    template <>
+    natives<context, true> context::native<true>() const
+    {
+        return {.pool = m_impl->platform->pool.get(), .store = m_impl->platform->store.get()};
+    }
 } // namespace saucer
@@ -5,6 +5,7 @@
 #include "gtk.window.impl.hpp"
 
 #include "wkg.url.impl.hpp"
+#include "wkg.context.impl.hpp"
 #include "wkg.webview.impl.hpp"
 #include "wkg.permission.impl.hpp"
 
@@ -45,4 +46,10 @@ namespace saucer
     {
         return {.icon = m_impl->texture.get()};
     }
+
+    template <>
+    natives<context, true> context::native<true>() const
+    {
+        return {.context = m_impl->platform->context.get(), .session = m_impl->platform->session.get()};
+    }
 } // namespace saucer
@@ -5,6 +5,7 @@
 #include "win32.window.impl.hpp"
 
 #include "wv2.url.impl.hpp"
+#include "wv2.context.impl.hpp"
 #include "wv2.webview.impl.hpp"
 #include "wv2.permission.impl.hpp"
 
@@ -45,4 +46,10 @@ namespace saucer
     {
         return {.icon = m_impl->bitmap.get()};
     }
+
+    template <>
+    natives<context, true> context::native<true>() const
+    {
+        return {.environment = m_impl->platform->environment.Get()};
+    }
 } // namespace saucer
@@ -0,0 +1,121 @@
+#include "pack.hpp"
+
+#include "mapping.hpp"
+#include "error.impl.hpp"
+
+#include <bit>
+#include <memory>
+#include <cstring>
+#include <string>
+#include <optional>
+#include <algorithm>
+#include <string_view>
+
+namespace saucer::pack
+{
+    // Layout (little endian):
+    //   char     magic[8]       "SAUCERPK"
+    //   uint32_t version
+    //   uint32_t count
+    //   count × { uint64_t offset, uint64_t size, uint32_t length, char path[length], uint32_t length, char mime[length] }
+    //   data    (offsets are relative to the start of the file)
+
+    static constexpr std::string_view magic = "SAUCERPK";
+    static constexpr std::uint32_t version  = 2;
+
+    struct reader
+    {
+        std::span<const std::uint8_t> data;
+        std::size_t offset{0};
+
+      public:
+        template <typename T>
+        [[nodiscard]] std::optional<T> read()
+        {
+            if (data.size() - offset < sizeof(T))
+            {
+                return std::nullopt;
+            }
+
+            T rtn{};
+            std::memcpy(&rtn, data.data() + offset, sizeof(T));
+
+            offset += sizeof(T);
+
+            if constexpr (std::endian::native == std::endian::big)
+            {
+                rtn = std::byteswap(rtn);
+            }
+
+            return rtn;
+        }
+
+        [[nodiscard]] std::optional<std::string_view> read(std::size_t length)
+        {
+            if (data.size() - offset < length)
+            {
+                return std::nullopt;
+            }
+
+            auto rtn = std::string_view{reinterpret_cast<const char *>(data.data() + offset), length};
+            offset += length;
+
+            return rtn;
+        }
+    };
+
+    result<std::unordered_map<fs::path, embedded_file>> open(const fs::path &file)
+    {
+        auto mapped = utils::mapping::map(file);
+
+        if (!mapped.has_value())
+        {
+            return err(mapped);
+        }
+
+        const auto owner = std::make_shared<const utils::mapping>(std::move(*mapped));
+        const auto data  = owner->data();
+
+        auto in = reader{.data = data};
+
+        if (in.read(magic.size()) != magic || in.read<std::uint32_t>() != version)
+        {
+            return err(std::errc::illegal_byte_sequence);
+        }
+
+        const auto count = in.read<std::uint32_t>();
+
+        if (!count.has_value())
+        {
+            return err(std::errc::illegal_byte_sequence);
+        }
+
+        auto rtn = std::unordered_map<fs::path, embedded_file>{};
+        rtn.reserve(std::min<std::size_t>(*count, data.size()));
+
+        for (auto i = 0u; *count > i; ++i)
+        {
+            const auto offset = in.read<std::uint64_t>();
+            const auto size   = in.read<std::uint64_t>();
+            const auto length = in.read<std::uint32_t>();
+
+            if (!offset || !size || !length)
+            {
+                return err(std::errc::illegal_byte_sequence);
+            }
+
+            const auto path = in.read(*length);
+            const auto type = in.read<std::uint32_t>().and_then([&in](auto size) { return in.read(size); });
+
+            if (!path.has_value() || !type.has_value() || *offset > data.size() || *size > data.size() - *offset)
+            {
+                return err(std::errc::illegal_byte_sequence);
+            }
+
+            const auto content = data.subspan(*offset, *size);
+            rtn.emplace(fs::path{*path}, embedded_file{.content = stash::share(owner, content), .mime = std::string{*type}});
+        }
+
+        return rtn;
+    }
+} // namespace saucer::pack
@@ -0,0 +1,214 @@
+#include "preload.hpp"
+
+#include "workers.hpp"
+
+#include <format>
+#include <cstdint>
+#include <fstream>
+#include <algorithm>
+
+namespace saucer::utils
+{
+    // Only resources requested shortly after their document are considered part of its first load,
+    // anything later is most likely caused by user interaction and should not be preloaded.
+
+    static constexpr auto first_load = std::chrono::seconds(5);
+    static constexpr auto maximum    = 32uz;
+
+    preloader::preloader(std::optional<fs::path> directory)
+        : m_directory(std::move(directory)), m_pending(std::make_shared<pending>())
+    {
+        load();
+    }
+
+    preloader::~preloader()
+    {
+        finish();
+    }
+
+    void preloader::document(const fs::path &document)
+    {
+        finish();
+        m_current.emplace(document, std::vector<fs::path>{}, clock::now());
+    }
+
+    void preloader::resource(const fs::path &resource)
+    {
+        if (!m_current.has_value())
+        {
+            return;
+        }
+
+        auto &[document, resources, started] = *m_current;
+
+        if (clock::now() - started > first_load || resources.size() >= maximum)
+        {
+            return finish();
+        }
+
+        if (resource == document || std::ranges::contains(resources, resource))
+        {
+            return;
+        }
+
+        resources.emplace_back(resource);
+    }
+
+    const std::vector<fs::path> &preloader::order(const fs::path &document) const
+    {
+        static const std::vector<fs::path> empty{};
+
+        const auto it = m_orders.find(document);
+
+        if (it == m_orders.end())
+        {
+            return empty;
+        }
+
+        return it->second;
+    }
+
+    fs::path preloader::file(const fs::path &directory, const fs::path &document)
+    {
+        // Every document gets its own file, so that views serving different pages from the same storage don't overwrite each
+        // other. The name has to be stable across runs, which rules out std::hash.
+
+        auto hash = 14695981039346656037ull;
+
+        for (const auto c : document.generic_string())
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ull;
+        }
+
+        return directory / std::format("{:016x}", hash);
+    }
+
+    void preloader::load()
+    {
+        if (!m_directory.has_value())
+        {
+            return;
+        }
+
+        // The first line of each file names the document, the remaining ones list its resources in load order.
+
+        auto ec = std::error_code{};
+
+        for (const auto &entry : fs::directory_iterator{*m_directory, ec})
+        {
+            auto stream = std::ifstream{entry.path()};
+            auto line   = std::string{};
+
+            if (!std::getline(stream, line) || line.empty())
+            {
+                continue;
+            }
+
+            auto &current = m_orders[fs::path{line}];
+            current.clear();
+
+            while (std::getline(stream, line) && !line.empty())
+            {
+                current.emplace_back(line);
+            }
+        }
+    }
+
+    void preloader::save(const fs::path &document)
+    {
+        if (!m_directory.has_value())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard guard{m_pending->mutex};
+            m_pending->orders.insert_or_assign(document, m_orders[document]);
+        }
+
+        // Writing happens on the shared workers to keep disk access off the scheme thread. Tasks are serialized by `writing` and
+        // always pick up the latest state, so an older snapshot can never replace a newer one.
+
+        auto write = [state = m_pending, directory = *m_directory]
+        {
+            std::lock_guard lock{state->writing};
+            auto orders = std::map<fs::path, std::vector<fs::path>>{};
+
+            {
+                std::lock_guard guard{state->mutex};
+                std::swap(orders, state->orders);
+            }
+
+            auto ec = std::error_code{};
+            fs::create_directories(directory, ec);
+
+            for (const auto &[path, resources] : orders)
+            {
+                const auto target = file(directory, path);
+                auto temporary    = target;
+
+                // Other views may write the same document, so the temporary file has to be unique to us.
+                temporary += std::format(".{}", reinterpret_cast<std::uintptr_t>(state.get()));
+
+                {
+                    auto stream = std::ofstream{temporary, std::ios::trunc};
+                    stream << path.generic_string() << '\n';
+
+                    for (const auto &resource : resources)
+                    {
+                        stream << resource.generic_string() << '\n';
+                    }
+                }
+
+                fs::rename(temporary, target, ec);
+            }
+        };
+
+        workers::shared().submit(std::move(write));
+    }
+
+    void preloader::finish()
+    {
+        if (!m_current.has_value())
+        {
+            return;
+        }
+
+        auto [document, resources, started] = std::move(*m_current);
+        m_current.reset();
+
+        if (resources.empty())
+        {
+            return;
+        }
+
+        // Resources served from the browsers memory cache will not show up again, so we keep the ones we knew about.
+
+        auto &stored = m_orders[document];
+        auto merged  = std::move(resources);
+
+        for (const auto &resource : stored)
+        {
+            if (merged.size() >= maximum)
+            {
+                break;
+            }
+
+            if (std::ranges::contains(merged, resource))
+            {
+                continue;
+            }
+
+            merged.emplace_back(resource);
+        }
+
+        if (stored == merged)
+        {
+            return;
+        }
+
+        stored = std::move(merged);
+        save(document);
+    }
+} // namespace saucer::utils
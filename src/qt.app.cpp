@@ -42,10 +42,10 @@ namespace saucer
         return rtn;
     }
 
-    void application::post(post_callback_t callback) const
+    void impl::schedule(post_callback_t callback) const
     {
         auto *const event = new safe_event{std::move(callback)};
-        QApplication::postEvent(m_impl->platform->application.get(), event);
+        QApplication::postEvent(platform->application.get(), event);
     }
 
     int impl::run(application *self, callback_t callback)
@@ -0,0 +1,35 @@
+#include "qt.context.impl.hpp"
+
+namespace saucer
+{
+    using impl = context::impl;
+
+    impl::impl() = default;
+
+    impl::~impl() = default;
+
+    result<> impl::init_platform()
+    {
+        using enum QWebEngineProfile::PersistentCookiesPolicy;
+
+        // Chromium decides on its own which pages share a renderer process, so only the profile is shared here.
+
+        const auto persistent = opts.persistent_cookies || opts.storage_path.has_value();
+        auto profile          = persistent ? std::make_shared<QWebEngineProfile>("saucer") : std::make_shared<QWebEngineProfile>();
+
+        if (opts.storage_path.has_value())
+        {
+            const auto path = QString::fromStdString(opts.storage_path->string());
+
+            profile->setCachePath(path);
+            profile->setPersistentStoragePath(path);
+        }
+
+        profile->setPersistentCookiesPolicy(opts.persistent_cookies ? ForcePersistentCookies : NoPersistentCookies);
+
+        platform          = std::make_unique<native>();
+        platform->profile = std::move(profile);
+
+        return {};
+    }
+} // namespace saucer
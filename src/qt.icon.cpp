@@ -4,7 +4,7 @@
 
 #include <cassert>
 
-#include <QPixmap>
+#include <QImage>
 #include <QBuffer>
 
 namespace saucer
@@ -36,61 +36,93 @@ namespace saucer
 
     bool icon::empty() const
     {
-        return m_impl->icon.isNull();
+        return m_impl->icon.isNull() && m_impl->image.isNull();
     }
 
     stash icon::data() const
     {
-        auto pixmap = m_impl->pixmap();
+        return m_impl->cache->encoded(
+            [this]
+            {
+                auto image = m_impl->largest();
 
-        if (!pixmap)
-        {
-            return stash::empty();
-        }
+                if (!image)
+                {
+                    return stash::empty();
+                }
+
+                auto bytes = std::make_shared<QByteArray>();
 
-        QByteArray bytes;
+                QBuffer buffer{bytes.get()};
+                image->save(&buffer, "PNG");
 
-        QBuffer buffer{&bytes};
-        pixmap->save(&buffer, "PNG");
+                const auto *data = reinterpret_cast<const std::uint8_t *>(bytes->constData());
+                const auto size  = static_cast<std::size_t>(bytes->size());
 
-        return stash::from({bytes.begin(), bytes.end()});
+                return stash::share(std::move(bytes), {data, size});
+            });
+    }
+
+    icon::bitmap icon::pixels() const
+    {
+        return m_impl->cache->decoded(
+            [this]
+            {
+                auto largest = m_impl->largest();
+
+                if (!largest)
+                {
+                    return bitmap{};
+                }
+
+                auto image      = std::make_shared<const QImage>(largest->convertToFormat(QImage::Format_RGBA8888));
+                const auto size = static_cast<std::size_t>(image->sizeInBytes());
+
+                return bitmap{
+                    .data   = stash::share(image, {image->constBits(), size}),
+                    .width  = static_cast<std::size_t>(image->width()),
+                    .height = static_cast<std::size_t>(image->height()),
+                    .stride = static_cast<std::size_t>(image->bytesPerLine()),
+                };
+            });
     }
 
     void icon::save(const fs::path &path) const
     {
         assert(path.extension() == ".png");
 
-        auto pixmap = m_impl->pixmap();
+        auto image = m_impl->largest();
 
-        if (!pixmap)
+        if (!image)
         {
             return;
         }
 
-        pixmap->save(path.c_str());
+        image->save(path.c_str());
     }
 
     result<icon> icon::from(const stash &ico)
     {
-        QPixmap rtn{};
+        // Only a `QImage` may be created off the gui thread, which `from_async` relies on.
+        QImage image{};
 
-        if (!rtn.loadFromData(ico.data(), ico.size()))
+        if (!image.loadFromData(ico.data(), ico.size()))
         {
             return err(std::error_code{});
         }
 
-        return icon{{rtn}};
+        return icon{{.image = std::move(image)}};
     }
 
     result<icon> icon::from(const fs::path &file)
     {
-        auto rtn = QIcon{QString::fromStdString(file.string())};
+        QImage image{};
 
-        if (rtn.isNull())
+        if (!image.load(QString::fromStdString(file.string())))
         {
             return err(std::error_code{});
         }
 
-        return icon{{rtn}};
+        return icon{{.image = std::move(image)}};
     }
 } // namespace saucer
@@ -4,8 +4,23 @@
 
 namespace saucer
 {
-    std::optional<QPixmap> icon::impl::pixmap() const
+    const QIcon &icon::impl::get() const
     {
+        if (icon.isNull() && !image.isNull())
+        {
+            icon = QIcon{QPixmap::fromImage(image)};
+        }
+
+        return icon;
+    }
+
+    std::optional<QImage> icon::impl::largest() const
+    {
+        if (!image.isNull())
+        {
+            return image;
+        }
+
         auto sizes = icon.availableSizes();
 
         if (sizes.empty())
@@ -19,6 +34,6 @@ namespace saucer
         };
         std::sort(sizes.begin(), sizes.end(), compare);
 
-        return icon.pixmap(sizes.first());
+        return icon.pixmap(sizes.first()).toImage();
     }
 } // namespace saucer
@@ -1,4 +1,7 @@
 #include "qt.webview.impl.hpp"
+#include "qt.context.impl.hpp"
+
+#include "monitor.hpp"
 
 #include "error.impl.hpp"
 
@@ -25,6 +28,11 @@ namespace saucer
 
     impl::impl() = default;
 
+    result<> impl::launch_platform(const options &)
+    {
+        return {};
+    }
+
     result<> impl::init_platform(const options &opts)
     {
         using enum QWebEngineProfile::PersistentCookiesPolicy;
@@ -48,14 +56,17 @@ namespace saucer
 
         qputenv("QTWEBENGINE_CHROMIUM_FLAGS", arguments.c_str());
 
-        auto profile = std::make_unique<QWebEngineProfile>("saucer");
+        const auto *context = opts.context.has_value() ? opts.context->native<false>() : nullptr;
+        auto profile        = context ? context->platform->profile : std::make_shared<QWebEngineProfile>("saucer");
 
         if (opts.user_agent.has_value())
         {
             profile->setHttpUserAgent(QString::fromStdString(*opts.user_agent));
         }
 
-        if (opts.storage_path.has_value())
+        // A shared profile has its storage configured by the context already.
+
+        if (!context && opts.storage_path.has_value())
         {
             const auto path = QString::fromStdString(opts.storage_path->string());
 
@@ -66,7 +77,11 @@ namespace saucer
         using enum QWebEngineProfile::PersistentPermissionsPolicy;
         profile->setPersistentPermissionsPolicy(AskEveryTime);
 
-        profile->setPersistentCookiesPolicy(opts.persistent_cookies ? ForcePersistentCookies : NoPersistentCookies);
+        if (!context)
+        {
+            profile->setPersistentCookiesPolicy(opts.persistent_cookies ? ForcePersistentCookies : NoPersistentCookies);
+        }
+
         profile->settings()->setAttribute(QWebEngineSettings::LocalContentCanAccessRemoteUrls, true);
         profile->settings()->setAttribute(QWebEngineSettings::FullScreenSupportEnabled, true);
 
@@ -74,7 +89,7 @@ namespace saucer
 
         platform->profile     = std::move(profile);
         platform->web_view    = utils::make_deferred<QWebEngineView>();
-        platform->web_page    = std::make_unique<QWebEnginePage>();
+        platform->web_page    = context ? std::make_unique<QWebEnginePage>(platform->profile.get()) : std::make_unique<QWebEnginePage>();
         platform->channel     = std::make_unique<QWebChannel>();
         platform->channel_obj = std::make_unique<web_class>(this);
 
@@ -105,15 +120,15 @@ namespace saucer
         platform->on_load = platform->web_view->connect(platform->web_view.get(), &QWebEngineView::loadStarted,
                                                         [this]
                                                         {
-                                                            platform->dom_loaded = false;
-                                                            events.get<event::load>().fire(state::started);
+                                                            dom_loaded = false;
+                                                            utils::fire<event::load>(events, state::started);
                                                         });
 
         platform->on_fullscreen =
             platform->web_page->connect(platform->web_page.get(), &QWebEnginePage::fullScreenRequested,
                                         [this](QWebEngineFullScreenRequest request)
                                         {
-                                            if (events.get<event::fullscreen>().fire(request.toggleOn()).find(policy::block))
+                                            if (utils::fire<event::fullscreen>(events, request.toggleOn()).find(policy::block))
                                             {
                                                 return request.reject();
                                             }
@@ -210,6 +225,18 @@ namespace saucer
         return {.x = geometry.x(), .y = geometry.y(), .w = geometry.width(), .h = geometry.height()};
     }
 
+    std::optional<std::uint32_t> impl::process_id() const
+    {
+        const auto pid = platform->web_page->renderProcessPid();
+
+        if (pid <= 0)
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<std::uint32_t>(pid);
+    }
+
     void impl::set_url(const saucer::url &url) // NOLINT(*-function-const)
     {
         platform->web_view->setUrl(url.native<false>()->url);
@@ -291,14 +318,27 @@ namespace saucer
         platform->web_view->reload();
     }
 
-    void impl::execute(cstring_view code) // NOLINT(*-function-const)
+    void impl::release_memory() // NOLINT(*-static)
     {
-        if (!platform->dom_loaded)
-        {
-            platform->pending.emplace_back(code);
-            return;
-        }
+        // Qt WebEngine does not expose a way to purge memory of a live page, only to freeze or discard it entirely.
+    }
+
+    coco::future<void> impl::clear_cache() // NOLINT(*-function-const)
+    {
+        auto promise = std::make_shared<coco::promise<void>>();
+        auto rtn     = promise->get_future();
+
+        auto *const profile = platform->profile.get();
+        auto resolve        = [promise] { promise->set_value(); };
 
+        profile->connect(profile, &QWebEngineProfile::clearHttpCacheCompleted, profile, resolve, Qt::SingleShotConnection);
+        profile->clearHttpCache();
+
+        return rtn;
+    }
+
+    void impl::evaluate(cstring_view code) // NOLINT(*-function-const)
+    {
         platform->web_view->page()->runJavaScript(QString::fromUtf8(code));
     }
 
@@ -339,6 +379,11 @@ namespace saucer
         return id;
     }
 
+    void impl::inject_builtin(const script &script)
+    {
+        inject(script);
+    }
+
     void impl::uninject()
     {
         static constexpr auto uninject = static_cast<void (impl::*)(std::size_t)>(&impl::uninject);
@@ -1,5 +1,7 @@
 #include "qt.webview.impl.hpp"
 
+#include "monitor.hpp"
+
 #include "qt.url.impl.hpp"
 #include "qt.icon.impl.hpp"
 
@@ -25,27 +27,22 @@ namespace saucer
 
         if (message == "dom_loaded")
         {
-            impl->platform->dom_loaded = true;
-
-            for (const auto &pending : impl->platform->pending)
-            {
-                impl->execute(pending);
-            }
+            impl->dom_loaded = true;
+            impl->flush();
 
-            impl->platform->pending.clear();
-            impl->events.get<event::dom_ready>().fire();
+            utils::fire<event::dom_ready>(impl->events);
 
             return;
         }
 
-        impl->events.get<event::message>().fire(message).find(status::handled);
+        utils::fire<event::message>(impl->events, message).find(status::handled);
     }
 
     request_interceptor::request_interceptor(webview::impl *impl) : impl(impl) {}
 
     void request_interceptor::interceptRequest(QWebEngineUrlRequestInfo &request)
     {
-        impl->events.get<event::request>().fire(url::impl{request.requestUrl()});
+        utils::fire<event::request>(impl->events, url::impl{request.requestUrl()});
     }
 
     template <>
@@ -73,7 +70,7 @@ namespace saucer
                 .origin  = raw.origin(),
             });
 
-            self->events.get<event::permission>().fire(req).find(status::handled);
+            utils::fire<event::permission>(self->events, req).find(status::handled);
         };
 
         const auto id = web_page->connect(web_page.get(), &QWebEnginePage::permissionRequested, handler);
@@ -102,7 +99,7 @@ namespace saucer
 
         auto handler = [self](const QUrl &url)
         {
-            self->events.get<event::navigated>().fire(url::impl{url});
+            utils::fire<event::navigated>(self->events, url::impl{url});
         };
 
         const auto id = web_view->connect(web_view.get(), &QWebEngineView::urlChanged, handler);
@@ -123,7 +120,7 @@ namespace saucer
         {
             auto request = navigation{navigation::impl{&req}};
 
-            if (!self->events.get<event::navigate>().fire(request).find(policy::block))
+            if (!utils::fire<event::navigate>(self->events, request).find(policy::block))
             {
                 return;
             }
@@ -161,7 +158,7 @@ namespace saucer
         }
 
         interceptor = std::make_unique<request_interceptor>(self);
-        profile->setUrlRequestInterceptor(interceptor.get());
+        web_page->setUrlRequestInterceptor(interceptor.get());
 
         event.on_clear([this] { interceptor.reset(); });
     }
@@ -178,7 +175,7 @@ namespace saucer
 
         auto handler = [self](const auto &favicon)
         {
-            self->events.get<event::favicon>().fire(icon{icon::impl{favicon}});
+            utils::fire<event::favicon>(self->events, icon{icon::impl{favicon}});
         };
 
         const auto id = web_view->connect(web_view.get(), &QWebEngineView::iconChanged, handler);
@@ -197,7 +194,7 @@ namespace saucer
 
         auto handler = [self](const auto &title)
         {
-            self->events.get<event::title>().fire(title.toStdString());
+            utils::fire<event::title>(self->events, title.toStdString());
         };
 
         const auto id = web_view->connect(web_view.get(), &QWebEngineView::titleChanged, handler);
@@ -216,13 +213,18 @@ namespace saucer
 
         auto handler = [self](auto...)
         {
-            self->events.get<event::load>().fire(state::finished);
+            utils::fire<event::load>(self->events, state::finished);
         };
 
         const auto id = web_view->connect(web_view.get(), &QWebEngineView::loadFinished, handler);
         event.on_clear([this, id] { web_view->disconnect(id); });
     }
 
+    template <>
+    void native::setup<event::usage>(impl *)
+    {
+    }
+
     QWebEngineScript native::find(const char *name) const
     {
         return web_page->scripts().find(name).at(0);
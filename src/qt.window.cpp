@@ -1,5 +1,7 @@
 #include "qt.window.impl.hpp"
 
+#include "monitor.hpp"
+
 #include "qt.app.impl.hpp"
 #include "qt.icon.impl.hpp"
 
@@ -292,7 +294,7 @@ namespace saucer
             return;
         }
 
-        platform->window->setWindowIcon(icon.native<false>()->icon);
+        platform->window->setWindowIcon(icon.native<false>()->get());
     }
 
     void impl::set_title(cstring_view title) // NOLINT(*-function-const)
@@ -317,7 +319,7 @@ namespace saucer
         platform->set_flags({{Qt::CustomizeWindowHint, decoration == partial}, {Qt::FramelessWindowHint, decoration == none}});
 
         // Qt does not offer a reliable way to detect window flag changes
-        events.get<event::decorated>().fire(decoration);
+        utils::fire<event::decorated>(events, decoration);
     }
 
     void impl::set_size(saucer::size size) // NOLINT(*-function-const)
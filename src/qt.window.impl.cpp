@@ -1,6 +1,9 @@
 #include "qt.window.impl.hpp"
 
+#include "monitor.hpp"
+
 #include <QCloseEvent>
+#include <QMoveEvent>
 
 namespace saucer
 {
@@ -42,7 +45,7 @@ namespace saucer
 
         if (event->type() == QEvent::ActivationChange)
         {
-            impl->events.get<event::focus>().fire(isActiveWindow());
+            utils::fire<event::focus>(impl->events, isActiveWindow());
             return;
         }
 
@@ -55,31 +58,38 @@ namespace saucer
 
         if (old->oldState().testFlag(Qt::WindowState::WindowMaximized) != isMaximized())
         {
-            impl->events.get<event::maximize>().fire(isMaximized());
+            utils::fire<event::maximize>(impl->events, isMaximized());
         }
 
         if (old->oldState().testFlag(Qt::WindowState::WindowMinimized) != isMinimized())
         {
-            impl->events.get<event::minimize>().fire(isMinimized());
+            utils::fire<event::minimize>(impl->events, isMinimized());
         }
     }
 
     void main_window::closeEvent(QCloseEvent *event)
     {
-        if (impl->events.get<event::close>().fire().find(policy::block))
+        if (utils::fire<event::close>(impl->events).find(policy::block))
         {
             event->ignore();
             return;
         }
 
         QMainWindow::closeEvent(event);
-        impl->events.get<event::closed>().fire();
+        utils::fire<event::closed>(impl->events);
     }
 
     void main_window::resizeEvent(QResizeEvent *event)
     {
         QMainWindow::resizeEvent(event);
-        impl->events.get<event::resize>().fire(width(), height());
+        utils::fire<event::resize>(impl->events, width(), height());
+    }
+
+    void main_window::moveEvent(QMoveEvent *event)
+    {
+        // saucer has no move event, yet the cached position has to follow the user dragging the window around.
+        QMainWindow::moveEvent(event);
+        impl->refresh();
     }
 
     overlay_layout::overlay_layout(window::impl *impl) : QLayout(), impl(impl) {}
@@ -0,0 +1,227 @@
+#include "scheme/router.hpp"
+
+#include <span>
+#include <ranges>
+#include <vector>
+
+namespace saucer::scheme
+{
+    struct target
+    {
+        router::endpoint endpoint;
+        std::vector<std::string> params;
+    };
+
+    struct node
+    {
+        std::map<std::string, std::unique_ptr<node>, std::less<>> children;
+
+      public:
+        std::unique_ptr<node> param;
+        std::unique_ptr<node> wildcard;
+
+      public:
+        std::map<std::string, target, std::less<>> targets;
+    };
+
+    struct router::impl
+    {
+        node root;
+
+      public:
+        [[nodiscard]] node &insert(std::string_view, std::vector<std::string> &);
+
+      public:
+        static const target *select(const node &, std::string_view method, bool &exists);
+        static const target *find(const node &, std::span<const std::string_view>, std::string_view, std::string_view method,
+                                  std::vector<std::string_view> &, bool &exists);
+    };
+
+    static auto segments(std::string_view path)
+    {
+        auto to_view = [](auto &&segment)
+        {
+            return std::string_view{segment.begin(), segment.end()};
+        };
+
+        return path                                                            //
+               | std::views::split('/')                                        //
+               | std::views::transform(to_view)                                //
+               | std::views::filter([](auto segment) { return !segment.empty(); }) //
+               | std::ranges::to<std::vector<std::string_view>>();
+    }
+
+    node &router::impl::insert(std::string_view pattern, std::vector<std::string> &params)
+    {
+        auto *current = &root;
+
+        for (const auto &segment : segments(pattern))
+        {
+            if (segment.starts_with('*'))
+            {
+                if (!current->wildcard)
+                {
+                    current->wildcard = std::make_unique<node>();
+                }
+
+                params.emplace_back(segment.size() > 1 ? segment.substr(1) : segment);
+
+                // Wildcards swallow the remainder of the path, so any following segment is meaningless.
+                return *current->wildcard;
+            }
+
+            if (segment.starts_with(':'))
+            {
+                if (!current->param)
+                {
+                    current->param = std::make_unique<node>();
+                }
+
+                params.emplace_back(segment.substr(1));
+                current = current->param.get();
+
+                continue;
+            }
+
+            auto it = current->children.find(segment);
+
+            if (it == current->children.end())
+            {
+                it = current->children.emplace(std::string{segment}, std::make_unique<node>()).first;
+            }
+
+            current = it->second.get();
+        }
+
+        return *current;
+    }
+
+    const target *router::impl::select(const node &current, std::string_view method, bool &exists)
+    {
+        if (current.targets.empty())
+        {
+            return nullptr;
+        }
+
+        exists = true;
+
+        if (auto it = current.targets.find(method); it != current.targets.end())
+        {
+            return &it->second;
+        }
+
+        if (auto it = current.targets.find("*"); it != current.targets.end())
+        {
+            return &it->second;
+        }
+
+        return nullptr;
+    }
+
+    const target *router::impl::find(const node &current, std::span<const std::string_view> path, std::string_view rest,
+                                     std::string_view method, std::vector<std::string_view> &captures, bool &exists)
+    {
+        // Static segments take precedence over parameters, which in turn take precedence over wildcards.
+        // We backtrack when a more specific branch turns out to be a dead end, or has no target for the requested method.
+
+        if (path.empty())
+        {
+            if (const auto *rtn = select(current, method, exists); rtn)
+            {
+                return rtn;
+            }
+        }
+        else
+        {
+            const auto segment = path.front();
+            const auto next    = std::string_view{segment.data() + segment.size(), rest.data() + rest.size()};
+
+            if (auto it = current.children.find(segment); it != current.children.end())
+            {
+                if (const auto *rtn = find(*it->second, path.subspan(1), next, method, captures, exists); rtn)
+                {
+                    return rtn;
+                }
+            }
+
+            if (current.param)
+            {
+                captures.emplace_back(segment);
+
+                if (const auto *rtn = find(*current.param, path.subspan(1), next, method, captures, exists); rtn)
+                {
+                    return rtn;
+                }
+
+                captures.pop_back();
+            }
+        }
+
+        if (!current.wildcard)
+        {
+            return nullptr;
+        }
+
+        const auto start = rest.find_first_not_of('/');
+        captures.emplace_back(start == std::string_view::npos ? std::string_view{} : rest.substr(start));
+
+        if (const auto *rtn = select(*current.wildcard, method, exists); rtn)
+        {
+            return rtn;
+        }
+
+        captures.pop_back();
+
+        return nullptr;
+    }
+
+    std::optional<std::string_view> route::param(std::string_view name) const
+    {
+        const auto it = params.find(name);
+
+        if (it == params.end())
+        {
+            return std::nullopt;
+        }
+
+        return it->second;
+    }
+
+    router::router() : m_impl(std::make_shared<impl>()) {}
+
+    void router::add(std::string method, std::string_view pattern, endpoint &&callback)
+    {
+        auto params = std::vector<std::string>{};
+        auto &leaf  = m_impl->insert(pattern, params);
+
+        leaf.targets.insert_or_assign(std::move(method), target{.endpoint = std::move(callback), .params = std::move(params)});
+    }
+
+    void router::operator()(request req, executor exec) const
+    {
+        auto url        = req.url();
+        const auto path = url.path().generic_string();
+
+        const auto method = req.method();
+
+        auto exists       = false;
+        auto captures     = std::vector<std::string_view>{};
+        const auto *match = impl::find(m_impl->root, segments(path), path, method, captures, exists);
+
+        if (!match)
+        {
+            // The path is known, but none of its routes accepts the method.
+            return exec.reject(exists ? error::invalid : error::not_found);
+        }
+
+        const auto &[callback, names] = *match;
+        auto matched                  = route{.url = std::move(url)};
+
+        for (auto i = 0uz; names.size() > i; ++i)
+        {
+            matched.params.emplace(names[i], captures[i]);
+        }
+
+        return callback(std::move(req), std::move(matched), std::move(exec));
+    }
+} // namespace saucer::scheme
@@ -0,0 +1,134 @@
+#include "sampler.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <libproc.h>
+#include <mach/mach_time.h>
+#else
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+#endif
+
+namespace saucer::utils
+{
+    using std::chrono::nanoseconds;
+    using std::chrono::steady_clock;
+
+#if defined(_WIN32)
+    std::optional<usage> sample(std::uint32_t process)
+    {
+        auto *const handle = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, false, process);
+
+        if (!handle)
+        {
+            return std::nullopt;
+        }
+
+        FILETIME creation{}, exit{}, kernel{}, user{};
+        PROCESS_MEMORY_COUNTERS memory{};
+
+        const auto success = GetProcessTimes(handle, &creation, &exit, &kernel, &user) && //
+                             GetProcessMemoryInfo(handle, &memory, sizeof(memory));
+        CloseHandle(handle);
+
+        if (!success)
+        {
+            return std::nullopt;
+        }
+
+        // File-times are counted in 100 nanosecond intervals.
+        static constexpr auto convert = [](const FILETIME &time)
+        {
+            return (static_cast<std::uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+        };
+
+        return usage{
+            .process  = process,
+            .time     = steady_clock::now(),
+            .cpu_time = nanoseconds{(convert(kernel) + convert(user)) * 100},
+            .resident = memory.WorkingSetSize,
+        };
+    }
+#elif defined(__APPLE__)
+    std::optional<usage> sample(std::uint32_t process)
+    {
+        rusage_info_v2 info{};
+
+        if (proc_pid_rusage(static_cast<int>(process), RUSAGE_INFO_V2, reinterpret_cast<rusage_info_t *>(&info)) != 0)
+        {
+            return std::nullopt;
+        }
+
+        // The cpu times are reported in mach ticks, which are only nanoseconds on intel machines.
+        static const auto timebase = []
+        {
+            mach_timebase_info_data_t rtn{};
+            mach_timebase_info(&rtn);
+            return rtn;
+        }();
+
+        const auto ticks = info.ri_user_time + info.ri_system_time;
+
+        return usage{
+            .process  = process,
+            .time     = steady_clock::now(),
+            .cpu_time = nanoseconds{ticks * timebase.numer / timebase.denom},
+            .resident = static_cast<std::size_t>(info.ri_resident_size),
+        };
+    }
+#else
+    std::optional<usage> sample(std::uint32_t process)
+    {
+        static const auto ticks = sysconf(_SC_CLK_TCK);
+        static const auto page  = sysconf(_SC_PAGESIZE);
+
+        const auto root = std::string{"/proc/"} + std::to_string(process);
+
+        auto stat  = std::ifstream{root + "/stat"};
+        auto statm = std::ifstream{root + "/statm"};
+
+        std::string line;
+
+        if (!std::getline(stat, line))
+        {
+            return std::nullopt;
+        }
+
+        // The executable name may contain spaces and parentheses, so the fields are counted from its closing parenthesis.
+        const auto name = line.rfind(')');
+
+        if (name == std::string::npos)
+        {
+            return std::nullopt;
+        }
+
+        auto fields = std::istringstream{line.substr(name + 1)};
+        std::string skipped;
+
+        // Skip from `state` (3) to `cmajflt` (13), see proc_pid_stat(5).
+        for (auto i = 0; i < 11; ++i)
+        {
+            fields >> skipped;
+        }
+
+        std::uint64_t user{}, system{};
+        std::size_t size{}, resident{};
+
+        if (!(fields >> user >> system) || !(statm >> size >> resident))
+        {
+            return std::nullopt;
+        }
+
+        return usage{
+            .process  = process,
+            .time     = steady_clock::now(),
+            .cpu_time = nanoseconds{(user + system) * 1'000'000'000 / static_cast<std::uint64_t>(ticks)},
+            .resident = resident * static_cast<std::size_t>(page),
+        };
+    }
+#endif
+} // namespace saucer::utils
@@ -3,6 +3,9 @@
 #include "webview.impl.hpp"
 
 #include "lease.hpp"
+#include "invoke.hpp"
+#include "monitor.hpp"
+#include "trace.hpp"
 #include "scripts.hpp"
 
 #include <atomic>
@@ -48,17 +51,24 @@ namespace saucer
         m_impl->lease      = utils::lease{webview::m_impl.get()};
         m_impl->serializer = std::move(serializer);
 
-        inject({
-            .code      = m_impl->serializer->script(),
-            .run_at    = script::time::creation,
-            .clearable = false,
-        });
+        auto builtin = [](webview::impl *self, const script &script)
+        {
+            self->inject_builtin(script);
+        };
+
+        utils::invoke(builtin, webview::m_impl.get(),
+                      script{
+                          .code      = m_impl->serializer->script(),
+                          .run_at    = script::time::creation,
+                          .clearable = false,
+                      });
 
-        inject({
-            .code      = std::format(bridge_script, m_impl->serializer->js_serializer()),
-            .run_at    = script::time::creation,
-            .clearable = false,
-        });
+        utils::invoke(builtin, webview::m_impl.get(),
+                      script{
+                          .code      = std::format(bridge_script, m_impl->serializer->js_serializer()),
+                          .run_at    = script::time::creation,
+                          .clearable = false,
+                      });
 
         on<event::message>({{.func = std::bind_front(&impl::on_message, m_impl.get()), .clearable = false}});
     }
@@ -69,7 +79,11 @@ namespace saucer
 
     status smartview_base::impl::on_message(std::string_view message)
     {
-        auto parsed = serializer->parse(message);
+        auto parsed = [&]
+        {
+            const auto span = trace::span{"ipc", "parse"};
+            return serializer->parse(message);
+        }();
 
         overload visitor = {
             [](std::monostate &)
@@ -110,6 +124,11 @@ namespace saucer
             utils::defer(lease, [id = message->id](auto *self, auto error) { return self->reject(id, error); }),
         };
 
+        // The name is copied as the message is handed over to the function
+        const auto name  = message->name;
+        const auto span  = trace::span{"exposed", name};
+        const auto timer = watchdog::timer{watchdog::origin::exposed, name};
+
         return (*function)(std::move(message), std::move(executor));
     }
 
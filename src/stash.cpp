@@ -0,0 +1,11 @@
+#include "stash/stash.hpp"
+
+#include "workers.hpp"
+
+namespace saucer
+{
+    void detail::prefetch(std::move_only_function<void()> task)
+    {
+        utils::workers::shared().submit(std::move(task));
+    }
+} // namespace saucer
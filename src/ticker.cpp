@@ -0,0 +1,95 @@
+#include "ticker.hpp"
+
+#include "app.hpp"
+
+#include <vector>
+#include <ranges>
+#include <utility>
+#include <algorithm>
+
+namespace saucer::utils
+{
+    void ticker::run(const std::stop_token &token)
+    {
+        auto lock = std::unique_lock{m_mutex};
+
+        while (!token.stop_requested())
+        {
+            if (m_entries.empty())
+            {
+                m_condition.wait(lock, token, [this] { return !m_entries.empty(); });
+                continue;
+            }
+
+            const auto next = std::ranges::min(m_entries | std::views::values, {}, &entry::deadline).deadline;
+
+            // Entries that were added or removed in the meantime may change the next deadline
+            if (m_condition.wait_until(lock, token, next, [this] { return std::exchange(m_changed, false); }) || token.stop_requested())
+            {
+                continue;
+            }
+
+            const auto now = clock::now();
+            std::vector<std::function<void()>> due;
+
+            for (auto &[id, entry] : m_entries)
+            {
+                if (entry.deadline > now)
+                {
+                    continue;
+                }
+
+                entry.deadline = now + entry.interval;
+                due.emplace_back(entry.callback);
+            }
+
+            // A busy event-loop should not pile up ticks, they'd be outdated by the time they run anyway.
+            if (due.empty() || m_pending->exchange(true))
+            {
+                continue;
+            }
+
+            m_parent->post(
+                [pending = m_pending, due = std::move(due)]
+                {
+                    for (const auto &callback : due)
+                    {
+                        callback();
+                    }
+
+                    pending->store(false);
+                });
+        }
+    }
+
+    std::size_t ticker::add(application *parent, std::chrono::milliseconds interval, std::function<void()> callback)
+    {
+        std::lock_guard guard{m_mutex};
+
+        const auto id = m_counter++;
+
+        m_parent  = parent;
+        m_changed = true;
+
+        m_entries.emplace(id, entry{.interval = interval, .deadline = clock::now() + interval, .callback = std::move(callback)});
+
+        if (!m_thread.joinable())
+        {
+            m_thread = std::jthread{[this](const std::stop_token &token) { run(token); }};
+        }
+
+        m_condition.notify_one();
+
+        return id;
+    }
+
+    void ticker::remove(std::size_t id)
+    {
+        std::lock_guard guard{m_mutex};
+
+        m_entries.erase(id);
+        m_changed = true;
+
+        m_condition.notify_one();
+    }
+} // namespace saucer::utils
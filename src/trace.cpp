@@ -0,0 +1,312 @@
+#include "trace.hpp"
+
+#include "error.impl.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <format>
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+namespace saucer::trace
+{
+    using clock = std::chrono::steady_clock;
+
+    struct record
+    {
+        const char *category;
+        char name[64];
+
+      public:
+        std::uint64_t begin;
+        std::uint64_t end;
+    };
+
+    struct slot
+    {
+        std::atomic_uint32_t sequence{0};
+        record value;
+    };
+
+    struct buffer
+    {
+        std::uint32_t tid;
+        std::uint64_t generation;
+
+      public:
+        std::size_t capacity;
+        std::unique_ptr<slot[]> slots;
+
+      public:
+        std::atomic_uint64_t head{0};
+        std::atomic_uint64_t flushed{0};
+
+      public:
+        void push(const record &);
+        void collect(std::vector<std::pair<std::uint32_t, record>> &);
+    };
+
+    struct state
+    {
+        std::atomic_bool enabled{false};
+        std::atomic_uint64_t generation{0};
+
+      public:
+        std::atomic<clock::rep> epoch{0};
+        std::size_t capacity{0};
+
+      public:
+        std::mutex mutex;
+        std::uint32_t tid_counter{0};
+        std::vector<std::shared_ptr<buffer>> buffers;
+
+      public:
+        static state &instance();
+    };
+
+    state &state::instance()
+    {
+        static state rtn;
+        return rtn;
+    }
+
+    void buffer::push(const record &value)
+    {
+        // Only the owning thread writes, readers use the per-slot sequence to skip entries that are being overwritten.
+
+        const auto index = head.load(std::memory_order_relaxed);
+        auto &entry      = slots[index % capacity];
+
+        const auto sequence = entry.sequence.load(std::memory_order_relaxed);
+        entry.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::memcpy(&entry.value, &value, sizeof(record));
+
+        entry.sequence.store(sequence + 2, std::memory_order_release);
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    void buffer::collect(std::vector<std::pair<std::uint32_t, record>> &out)
+    {
+        const auto end   = head.load(std::memory_order_acquire);
+        const auto begin = std::max(flushed.load(std::memory_order_relaxed), end > capacity ? end - capacity : 0);
+
+        for (auto i = begin; i < end; ++i)
+        {
+            auto &entry = slots[i % capacity];
+
+            const auto before = entry.sequence.load(std::memory_order_acquire);
+
+            if (before % 2 != 0)
+            {
+                continue;
+            }
+
+            record value{};
+            std::memcpy(&value, &entry.value, sizeof(record));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (entry.sequence.load(std::memory_order_relaxed) != before)
+            {
+                continue;
+            }
+
+            out.emplace_back(tid, value);
+        }
+
+        flushed.store(end, std::memory_order_relaxed);
+    }
+
+    static buffer &local()
+    {
+        static thread_local std::shared_ptr<buffer> rtn;
+
+        auto &global = state::instance();
+
+        if (rtn && rtn->generation == global.generation.load(std::memory_order_acquire))
+        {
+            return *rtn;
+        }
+
+        std::lock_guard guard{global.mutex};
+
+        rtn             = std::make_shared<buffer>();
+        rtn->tid        = ++global.tid_counter;
+        rtn->generation = global.generation.load(std::memory_order_relaxed);
+        rtn->capacity   = global.capacity;
+        rtn->slots      = std::make_unique<slot[]>(global.capacity);
+
+        global.buffers.emplace_back(rtn);
+
+        return *rtn;
+    }
+
+    static std::uint64_t now()
+    {
+        // Spans may be opened by other threads while `start` moves the epoch, which can make them appear to start before it.
+
+        const auto epoch   = clock::duration{state::instance().epoch.load(std::memory_order_acquire)};
+        const auto elapsed = std::max(clock::now().time_since_epoch() - epoch, clock::duration::zero());
+
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    static std::size_t truncate(std::string_view name, std::size_t limit)
+    {
+        // Cuts on a code-point boundary, so that the trace never contains a partial UTF-8 sequence.
+
+        if (name.size() <= limit)
+        {
+            return name.size();
+        }
+
+        auto rtn = limit;
+
+        while (rtn > 0 && (static_cast<unsigned char>(name[rtn]) & 0xC0) == 0x80)
+        {
+            --rtn;
+        }
+
+        return rtn;
+    }
+
+    static std::string escape(std::string_view value)
+    {
+        std::string rtn;
+        rtn.reserve(value.size());
+
+        for (const auto c : value)
+        {
+            switch (c)
+            {
+            case '"':
+                rtn += "\\\"";
+                break;
+            case '\\':
+                rtn += "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    rtn += std::format("\\u{:04x}", static_cast<int>(c));
+                    break;
+                }
+                rtn += c;
+            }
+        }
+
+        return rtn;
+    }
+
+    void start(std::size_t capacity)
+    {
+        auto &global = state::instance();
+        std::lock_guard guard{global.mutex};
+
+        // Bumping the generation makes every thread allocate a fresh buffer on its next span
+        global.buffers.clear();
+        global.generation.fetch_add(1, std::memory_order_release);
+
+        global.epoch.store(clock::now().time_since_epoch().count(), std::memory_order_release);
+        global.capacity = std::max<std::size_t>(capacity, 1);
+
+        global.enabled.store(true, std::memory_order_release);
+    }
+
+    void stop()
+    {
+        state::instance().enabled.store(false, std::memory_order_release);
+    }
+
+    bool enabled()
+    {
+        return state::instance().enabled.load(std::memory_order_relaxed);
+    }
+
+    result<> flush(const fs::path &file)
+    {
+        auto &global = state::instance();
+
+        std::vector<std::shared_ptr<buffer>> buffers;
+
+        {
+            std::lock_guard guard{global.mutex};
+            buffers = global.buffers;
+        }
+
+        std::vector<std::pair<std::uint32_t, record>> records;
+
+        for (const auto &buffer : buffers)
+        {
+            buffer->collect(records);
+        }
+
+        std::ranges::sort(records, {}, [](const auto &entry) { return entry.second.begin; });
+
+        auto stream = std::ofstream{file, std::ios::trunc};
+
+        if (!stream)
+        {
+            return err(std::errc::io_error);
+        }
+
+        stream << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+        for (auto first = true; const auto &[tid, entry] : records)
+        {
+            const auto name = std::string_view{entry.name};
+
+            stream << std::format(R"({}{{"name":"{}","cat":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                                  first ? "" : ",", escape(name), entry.category, tid, static_cast<double>(entry.begin) / 1000.0,
+                                  static_cast<double>(entry.end - entry.begin) / 1000.0);
+
+            first = false;
+        }
+
+        stream << "]}";
+
+        if (!stream)
+        {
+            return err(std::errc::io_error);
+        }
+
+        return {};
+    }
+
+    span::span(const char *category, std::string_view name) : m_category(category), m_name(name), m_start(0)
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        m_start = now() + 1;
+    }
+
+    span::~span()
+    {
+        if (!m_start)
+        {
+            return;
+        }
+
+        const auto begin = m_start - 1;
+
+        record value{
+            .category = m_category,
+            .name     = {},
+            .begin    = begin,
+            .end      = std::max(now(), begin),
+        };
+
+        std::memcpy(value.name, m_name.data(), truncate(m_name, sizeof(value.name) - 1));
+
+        local().push(value);
+    }
+} // namespace saucer::trace
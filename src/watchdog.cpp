@@ -0,0 +1,228 @@
+#include "monitor.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <algorithm>
+#include <stop_token>
+#include <condition_variable>
+
+namespace saucer::watchdog
+{
+    struct state
+    {
+        std::atomic_bool enabled{false};
+        std::atomic<clock::rep> threshold{0};
+
+      public:
+        std::atomic_size_t loop{0};
+        std::atomic_size_t task{0};
+        std::atomic_size_t event{0};
+        std::atomic_size_t exposed{0};
+        std::atomic<clock::rep> longest{0};
+
+      public:
+        std::mutex mutex;
+        std::jthread heartbeat;
+        std::function<void(const stall &)> callback;
+
+      public:
+        std::atomic_bool armed{false};
+        std::mutex signal;
+        std::condition_variable_any wake;
+
+      public:
+        static state &instance();
+    };
+
+    static thread_local bool beating{false};
+
+    state &state::instance()
+    {
+        static state rtn;
+        return rtn;
+    }
+
+    static void report(origin kind, std::string_view name, clock::duration duration)
+    {
+        auto &global = state::instance();
+
+        switch (kind)
+        {
+        case origin::loop:
+            global.loop++;
+            break;
+        case origin::task:
+            global.task++;
+            break;
+        case origin::event:
+            global.event++;
+            break;
+        case origin::exposed:
+            global.exposed++;
+            break;
+        }
+
+        auto longest = global.longest.load(std::memory_order_relaxed);
+        while (longest < duration.count() && !global.longest.compare_exchange_weak(longest, duration.count()))
+        {
+        }
+
+        std::function<void(const stall &)> callback;
+
+        {
+            std::lock_guard guard{global.mutex};
+            callback = global.callback;
+        }
+
+        if (!callback)
+        {
+            return;
+        }
+
+        callback({.kind = kind, .name = std::string{name}, .duration = duration});
+    }
+
+    static void beat(std::stop_token token, application *app)
+    {
+        // Posts a probe to the main thread and waits for it to come back. The time the probe spent in the queue is the
+        // latency of the event-loop, which also catches stalls caused by native callbacks we don't dispatch ourselves.
+        // While there is work queued the probe is posted every half threshold, an idle event-loop is only probed at a low
+        // rate so that a native callback that blocks it is still noticed.
+
+        static constexpr auto idle = std::chrono::seconds{1};
+
+        auto &global = state::instance();
+        auto pending = std::make_shared<std::atomic_bool>(false);
+
+        beating = true;
+
+        while (!token.stop_requested())
+        {
+            const auto threshold = clock::duration{global.threshold.load(std::memory_order_relaxed)};
+
+            {
+                std::unique_lock lock{global.signal};
+                global.wake.wait_for(lock, token, std::max<clock::duration>(threshold, idle), [&global] { return global.armed.load(); });
+            }
+
+            if (token.stop_requested())
+            {
+                return;
+            }
+
+            global.armed.store(false);
+
+            if (!pending->exchange(true))
+            {
+                auto probe = [pending, threshold, posted = clock::now()]
+                {
+                    const auto latency = clock::now() - posted;
+                    pending->store(false);
+
+                    if (latency < threshold)
+                    {
+                        return;
+                    }
+
+                    report(origin::loop, "event-loop", latency);
+                };
+
+                app->post(std::move(probe), "saucer::watchdog::heartbeat");
+            }
+
+            const auto interval = std::max<clock::duration>(threshold / 2, std::chrono::milliseconds{1});
+
+            std::unique_lock lock{global.signal};
+            global.wake.wait_for(lock, token, interval, [] { return false; });
+        }
+    }
+
+    void arm()
+    {
+        auto &global = state::instance();
+
+        // Our own probes must not re-arm the heartbeat, otherwise it would keep itself alive.
+        if (beating || !global.enabled.load(std::memory_order_relaxed) || global.armed.exchange(true))
+        {
+            return;
+        }
+
+        {
+            std::lock_guard guard{global.signal};
+        }
+
+        global.wake.notify_one();
+    }
+
+    timer::timer(origin kind, std::string_view name)
+        : m_kind(kind), m_name(name), m_active(state::instance().enabled.load(std::memory_order_relaxed))
+    {
+        if (!m_active)
+        {
+            return;
+        }
+
+        m_start = clock::now();
+    }
+
+    timer::~timer()
+    {
+        if (!m_active)
+        {
+            return;
+        }
+
+        const auto elapsed   = clock::now() - m_start;
+        const auto threshold = clock::duration{state::instance().threshold.load(std::memory_order_relaxed)};
+
+        if (elapsed < threshold)
+        {
+            return;
+        }
+
+        report(m_kind, m_name, elapsed);
+    }
+
+    void start(application *app, options opts)
+    {
+        auto &global = state::instance();
+        std::lock_guard guard{global.mutex};
+
+        global.threshold.store(opts.threshold.count(), std::memory_order_relaxed);
+        global.callback = std::move(opts.callback);
+
+        if (!global.heartbeat.joinable())
+        {
+            global.heartbeat = std::jthread{beat, app};
+        }
+
+        global.enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void stop()
+    {
+        auto &global = state::instance();
+        std::lock_guard guard{global.mutex};
+
+        global.enabled.store(false, std::memory_order_relaxed);
+        global.callback = nullptr;
+
+        // Requests a stop and joins, the heartbeat never touches the mutex so this can't deadlock
+        global.heartbeat = {};
+    }
+
+    counters snapshot()
+    {
+        auto &global = state::instance();
+
+        return {
+            .loop    = global.loop.load(),
+            .task    = global.task.load(),
+            .event   = global.event.load(),
+            .exposed = global.exposed.load(),
+            .longest = clock::duration{global.longest.load()},
+        };
+    }
+} // namespace saucer::watchdog
@@ -1,11 +1,18 @@
 #include "webview.impl.hpp"
 
 #include "invoke.hpp"
+#include "trace.hpp"
 #include "instantiate.hpp"
 
+#include "monitor.hpp"
+#include "sampler.hpp"
+
+#include "app.impl.hpp"
 #include "error.impl.hpp"
 #include "window.impl.hpp"
+#include "context.impl.hpp"
 
+#include <cctype>
 #include <format>
 #include <algorithm>
 #include <functional>
@@ -21,21 +28,25 @@ namespace saucer
 
     webview::webview(webview &&other) noexcept = default;
 
-    result<webview> webview::create(const options &opts)
+    static webview::options configure(const webview::options &opts)
     {
-        auto window = opts.window.value();
+        auto rtn = opts;
 
-        if (!window)
+        if (!rtn.context.has_value())
         {
-            return err(contract_error::required_invalid);
+            return rtn;
         }
 
-        auto *const parent = window->native<false>()->parent;
+        const auto &shared     = rtn.context->native<false>()->opts;
+        rtn.storage_path       = shared.storage_path;
+        rtn.persistent_cookies = shared.persistent_cookies;
 
-        if (!parent->thread_safe())
-        {
-            return parent->invoke(&webview::create, opts);
-        }
+        return rtn;
+    }
+
+    result<webview> webview::launch(const options &opts)
+    {
+        const auto span = trace::span{"webview", "launch"};
 
         if (static auto once{true}; once)
         {
@@ -43,34 +54,186 @@ namespace saucer
             once = false;
         }
 
+        auto *const parent = opts.window.value()->native<false>()->parent;
+
         auto rtn         = webview{parent};
         auto *const impl = rtn.m_impl.get();
 
         impl->window     = opts.window.value();
         impl->parent     = parent;
+        impl->lease      = utils::lease{impl};
         impl->attributes = opts.attributes;
 
-        if (auto status = impl->init_platform(opts); !status.has_value())
+        const auto config = configure(opts);
+
+        if (config.preload_hints)
+        {
+            impl->preloader.emplace(config.storage_path.transform([](const auto &path) { return path / "preload"; }));
+        }
+
+        if (auto status = impl->launch_platform(config); !status.has_value())
         {
             return err(status);
         }
 
-        rtn.on<event::message>({{.func = std::bind_front(&impl::on_message, impl), .clearable = false}});
+        return rtn;
+    }
 
-        rtn.inject({.code = impl::creation_script(), .run_at = script::time::creation, .clearable = false});
-        rtn.inject({.code = impl::ready_script(), .run_at = script::time::ready, .clearable = false});
+    result<> webview::complete(const options &opts)
+    {
+        const auto span = trace::span{"webview", "complete"};
+
+        auto *const impl   = m_impl.get();
+        auto *const parent = impl->parent;
+
+        if (auto status = impl->init_platform(configure(opts)); !status.has_value())
+        {
+            return err(status);
+        }
+
+        on<event::message>({{.func = std::bind_front(&impl::on_message, impl), .clearable = false}});
+
+        impl->inject_builtin({.code = impl::creation_script(), .run_at = script::time::creation, .clearable = false});
+        impl->inject_builtin({.code = impl::ready_script(), .run_at = script::time::ready, .clearable = false});
 
         if (opts.attributes)
         {
-            rtn.inject({.code = impl::attribute_script(), .run_at = script::time::creation, .clearable = false});
+            impl->inject_builtin({.code = impl::attribute_script(), .run_at = script::time::creation, .clearable = false});
+            on<event::dom_ready>({{.func = std::bind_front(&impl::push_state, impl), .clearable = false}});
+
+            auto push = [impl](bool)
+            {
+                impl->push_state();
+            };
+
+            impl->id_maximize = impl->window->on<saucer::window::event::maximize>({{.func = push, .clearable = false}});
+            impl->id_minimize = impl->window->on<saucer::window::event::minimize>({{.func = push, .clearable = false}});
+        }
+
+        if (opts.sample_interval.has_value())
+        {
+            auto task = utils::defer(impl->lease,
+                                     [](auto *self)
+                                     {
+                                         auto sample = self->process_id().and_then(utils::sample);
+
+                                         if (!sample.has_value())
+                                         {
+                                             return;
+                                         }
+
+                                         utils::fire<event::usage>(self->events, *sample);
+                                     });
+
+            impl->id_sample = parent->native<false>()->ticker.add(parent, *opts.sample_interval, std::move(task));
         }
 
+        return {};
+    }
+
+    result<webview> webview::create(const options &opts)
+    {
+        auto window = opts.window.value();
+
+        if (!window)
+        {
+            return err(contract_error::required_invalid);
+        }
+
+        auto *const parent = window->native<false>()->parent;
+
+        if (!parent->thread_safe())
+        {
+            return parent->invoke(&webview::create, opts);
+        }
+
+        auto rtn = launch(opts);
+
+        if (!rtn.has_value())
+        {
+            return err(rtn);
+        }
+
+        if (auto status = rtn->complete(opts); !status.has_value())
+        {
+            return err(status);
+        }
+
+        return rtn;
+    }
+
+    void webview::create_async(const options &opts, created_t callback)
+    {
+        auto window = opts.window.value();
+
+        if (!window)
+        {
+            return callback(err(contract_error::required_invalid));
+        }
+
+        auto *const parent = window->native<false>()->parent;
+
+        // Creation is split into two tasks. When several webviews are requested at once, all of them are launched (which e.g.
+        // starts their web-process) before any of them continues with its scripts and schemes, so their native setup overlaps.
+
+        auto launched = [parent, opts, callback = std::move(callback)]() mutable
+        {
+            auto rtn = launch(opts);
+
+            if (!rtn.has_value())
+            {
+                return callback(err(rtn));
+            }
+
+            auto completed = [opts, callback = std::move(callback), rtn = std::move(*rtn)]() mutable
+            {
+                if (auto status = rtn.complete(opts); !status.has_value())
+                {
+                    return callback(err(status));
+                }
+
+                callback(std::move(rtn));
+            };
+
+            parent->post(std::move(completed), "saucer::webview::create_async");
+        };
+
+        parent->post(std::move(launched), "saucer::webview::create_async");
+    }
+
+    coco::future<result<webview>> webview::create_async(const options &opts)
+    {
+        auto promise = coco::promise<result<webview>>{};
+        auto rtn     = promise.get_future();
+
+        create_async(opts, [promise = std::move(promise)](result<webview> value) mutable { promise.set_value(std::move(value)); });
+
         return rtn;
     }
 
     webview::~webview()
     {
-        utils::invoke([](auto *impl) { impl->events.clear(true); }, m_impl.get());
+        auto cleanup = [](auto *impl)
+        {
+            impl->events.clear(true);
+
+            if (impl->id_maximize.has_value())
+            {
+                impl->window->off(saucer::window::event::maximize, *impl->id_maximize);
+            }
+
+            if (impl->id_minimize.has_value())
+            {
+                impl->window->off(saucer::window::event::minimize, *impl->id_minimize);
+            }
+
+            if (impl->id_sample.has_value())
+            {
+                impl->parent->native<false>()->ticker.remove(*impl->id_sample);
+            }
+        };
+
+        utils::invoke(cleanup, m_impl.get());
     }
 
     template <webview::event Event>
@@ -90,24 +253,144 @@ namespace saucer
         }
 
         const auto file = url.path();
+        auto data       = find_embedded(file);
 
-        if (!embedded.contains(file))
+        if (!data.has_value())
         {
             return reject(scheme::error::not_found);
         }
 
-        const auto &data = embedded.at(file);
+        auto headers = std::map<std::string, std::string>{{"Access-Control-Allow-Origin", "*"}};
+
+        if (preloader.has_value() && data->mime.starts_with("text/html"))
+        {
+            preloader->document(file);
+
+            if (auto hints = preload_hints(file); !hints.empty())
+            {
+                headers.emplace("Link", std::move(hints));
+            }
+        }
+        else if (preloader.has_value())
+        {
+            preloader->resource(file);
+        }
 
         return resolve({
-            .data    = data.content,
-            .mime    = data.mime,
-            .headers = {{"Access-Control-Allow-Origin", "*"}},
+            .data    = std::move(data->content),
+            .mime    = std::move(data->mime),
+            .headers = std::move(headers),
         });
     }
 
+    std::optional<embedded_file> webview::impl::find_embedded(const fs::path &file) const
+    {
+        if (auto it = embedded.find(file); it != embedded.end())
+        {
+            return it->second;
+        }
+
+        for (const auto &set : attached)
+        {
+            if (auto rtn = set.find(file); rtn.has_value())
+            {
+                return rtn;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    static std::string percent_encode(std::string_view path)
+    {
+        // Only unreserved characters and the path separator are kept, everything else could break the `Link` header.
+
+        static constexpr auto unreserved = [](unsigned char c)
+        {
+            return std::isalnum(c) || c == '-' || c == '.' || c == '_' || c == '~' || c == '/';
+        };
+
+        auto rtn = std::string{};
+        rtn.reserve(path.size());
+
+        for (const auto c : path)
+        {
+            if (unreserved(static_cast<unsigned char>(c)))
+            {
+                rtn += c;
+                continue;
+            }
+
+            rtn += std::format("%{:02X}", static_cast<unsigned char>(c));
+        }
+
+        return rtn;
+    }
+
+    std::string webview::impl::preload_hints(const fs::path &document) const
+    {
+        static constexpr auto destination = [](std::string_view mime) -> std::optional<std::string_view>
+        {
+            if (mime.starts_with("text/css"))
+            {
+                return "style";
+            }
+
+            if (mime.contains("javascript"))
+            {
+                return "script";
+            }
+
+            if (mime.starts_with("font/"))
+            {
+                return "font";
+            }
+
+            if (mime.starts_with("image/"))
+            {
+                return "image";
+            }
+
+            return std::nullopt;
+        };
+
+        auto rtn = std::string{};
+
+        for (const auto &resource : preloader->order(document))
+        {
+            const auto file = find_embedded(resource);
+
+            if (!file.has_value())
+            {
+                continue;
+            }
+
+            const auto as = destination(file->mime);
+
+            if (!as.has_value())
+            {
+                continue;
+            }
+
+            // Fonts are always fetched in CORS mode, a preload without `crossorigin` would not be reused.
+            const auto *cors = *as == "font" ? "; crossorigin" : "";
+
+            const auto target = percent_encode(resource.generic_string());
+            rtn += std::format("{}<{}>; rel=preload; as={}{}", rtn.empty() ? "" : ", ", target, *as, cors);
+        }
+
+        return rtn;
+    }
+
     void webview::handle_scheme(const std::string &name, scheme::resolver &&handler)
     {
-        return utils::invoke<&impl::handle_scheme>(m_impl.get(), name, std::move(handler));
+        auto traced = [name, handler = std::move(handler)](scheme::request request, scheme::executor executor)
+        {
+            const auto span = trace::span{"scheme", name};
+            return handler(std::move(request), std::move(executor));
+        };
+
+        return utils::invoke<&impl::handle_scheme>(m_impl.get(), name, scheme::resolver{std::move(traced)});
     }
 
     void impl::reject(std::size_t id, std::string_view reason)
@@ -117,7 +400,7 @@ namespace saucer
             delete window.saucer.internal.rpc[{0}];
         )";
 
-        return utils::invoke([id, reason](auto *impl) { impl->execute(std::format(code, id, reason)); }, this);
+        return utils::dispatch([script = std::format(code, id, reason)](auto *impl) { impl->execute(script); }, this);
     }
 
     void impl::resolve(std::size_t id, std::string_view result)
@@ -127,7 +410,7 @@ namespace saucer
             delete window.saucer.internal.rpc[{0}];
         )";
 
-        return utils::invoke([id, result](auto *impl) { impl->execute(std::format(code, id, result)); }, this);
+        return utils::dispatch([script = std::format(code, id, result)](auto *impl) { impl->execute(script); }, this);
     }
 
     window &webview::parent() const
@@ -175,9 +458,19 @@ namespace saucer
         return utils::invoke<&impl::bounds>(m_impl.get());
     }
 
+    std::optional<std::uint32_t> webview::process_id() const
+    {
+        return utils::invoke<&impl::process_id>(m_impl.get());
+    }
+
+    std::optional<saucer::usage> webview::usage() const
+    {
+        return process_id().and_then(utils::sample);
+    }
+
     void webview::set_url(const saucer::url &url)
     {
-        return utils::invoke<&impl::set_url>(m_impl.get(), url);
+        return utils::dispatch<&impl::set_url>(m_impl.get(), url);
     }
 
     void webview::set_url(cstring_view str)
@@ -194,52 +487,62 @@ namespace saucer
 
     void webview::set_html(cstring_view html)
     {
-        return utils::invoke<&impl::set_html>(m_impl.get(), html);
+        return utils::dispatch<&impl::set_html>(m_impl.get(), html);
     }
 
     void webview::set_dev_tools(bool value)
     {
-        return utils::invoke<&impl::set_dev_tools>(m_impl.get(), value);
+        return utils::dispatch<&impl::set_dev_tools>(m_impl.get(), value);
     }
 
     void webview::set_context_menu(bool value)
     {
-        return utils::invoke<&impl::set_context_menu>(m_impl.get(), value);
+        return utils::dispatch<&impl::set_context_menu>(m_impl.get(), value);
     }
 
     void webview::set_force_dark(bool value)
     {
-        return utils::invoke<&impl::set_force_dark>(m_impl.get(), value);
+        return utils::dispatch<&impl::set_force_dark>(m_impl.get(), value);
     }
 
     void webview::set_background(color background)
     {
-        return utils::invoke<&impl::set_background>(m_impl.get(), background);
+        return utils::dispatch<&impl::set_background>(m_impl.get(), background);
     }
 
     void webview::reset_bounds()
     {
-        return utils::invoke<&impl::reset_bounds>(m_impl.get());
+        return utils::dispatch<&impl::reset_bounds>(m_impl.get());
     }
 
     void webview::set_bounds(saucer::bounds bounds)
     {
-        return utils::invoke<&impl::set_bounds>(m_impl.get(), bounds);
+        return utils::dispatch<&impl::set_bounds>(m_impl.get(), bounds);
     }
 
     void webview::back()
     {
-        return utils::invoke<&impl::back>(m_impl.get());
+        return utils::dispatch<&impl::back>(m_impl.get());
     }
 
     void webview::forward()
     {
-        return utils::invoke<&impl::forward>(m_impl.get());
+        return utils::dispatch<&impl::forward>(m_impl.get());
     }
 
     void webview::reload()
     {
-        return utils::invoke<&impl::reload>(m_impl.get());
+        return utils::dispatch<&impl::reload>(m_impl.get());
+    }
+
+    void webview::release_memory()
+    {
+        return utils::invoke<&impl::release_memory>(m_impl.get());
+    }
+
+    coco::future<void> webview::clear_cache()
+    {
+        return utils::invoke<&impl::clear_cache>(m_impl.get());
     }
 
     void webview::serve(fs::path file)
@@ -258,11 +561,23 @@ namespace saucer
         return utils::invoke(embed, m_impl.get(), std::move(files));
     }
 
+    void webview::embed(assets files)
+    {
+        auto embed = [](auto *impl, auto files)
+        {
+            impl->attached.emplace_back(std::move(files));
+            impl->handle_scheme("saucer", std::bind_front(&impl::handle_embed, impl));
+        };
+
+        return utils::invoke(embed, m_impl.get(), std::move(files));
+    }
+
     void webview::unembed()
     {
         auto unembed = [](auto *impl)
         {
             impl->embedded.clear();
+            impl->attached.clear();
             impl->remove_scheme("saucer");
         };
 
@@ -274,13 +589,19 @@ namespace saucer
         return utils::invoke([file](auto *impl) { impl->embedded.erase(file); }, m_impl.get());
     }
 
+    void webview::unembed(const assets &files)
+    {
+        return utils::invoke([files](auto *impl) { std::erase(impl->attached, files); }, m_impl.get());
+    }
+
     void webview::execute(cstring_view code)
     {
-        return utils::invoke<&impl::execute>(m_impl.get(), code);
+        return utils::dispatch<&impl::execute>(m_impl.get(), code);
     }
 
     std::size_t webview::inject(const script &script)
     {
+        const auto span = trace::span{"script", "inject"};
         return utils::invoke<&impl::inject>(m_impl.get(), script);
     }
 
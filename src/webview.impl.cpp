@@ -3,10 +3,20 @@
 #include "scripts.hpp"
 #include "request.hpp"
 
+#include <utility>
+
 namespace saucer
 {
     using impl = webview::impl;
 
+    void impl::push_state()
+    {
+        // The page keeps a mirror of the window state, so that e.g. toggling maximize does not require a round trip.
+
+        static constexpr auto code = "window.saucer.internal.state = {{ maximized: {}, minimized: {} }};";
+        execute(std::format(code, window->maximized(), window->minimized()));
+    }
+
     status impl::on_message(std::string_view message)
     {
         if (!attributes)
@@ -36,6 +46,35 @@ namespace saucer
         return status::handled;
     }
 
+    void impl::flush()
+    {
+        // Everything executed before the page became ready is drained in one go. Every snippet keeps its own evaluation though:
+        // an indirect `eval` would be rejected by pages whose CSP forbids 'unsafe-eval', and concatenating the snippets would let
+        // a syntax error in one of them take down all the others.
+
+        if (!dom_loaded || pending.empty())
+        {
+            return;
+        }
+
+        for (const auto &script : std::exchange(pending, {}))
+        {
+            evaluate(script);
+        }
+    }
+
+    void impl::execute(cstring_view code)
+    {
+        // Once the page is ready, scripts are evaluated right away so that they keep their order relative to e.g. navigations.
+
+        if (dom_loaded)
+        {
+            return evaluate(code);
+        }
+
+        pending.emplace_back(code);
+    }
+
     std::string impl::attribute_script()
     {
         static const auto rtn = std::format(scripts::attribute_script, request::stubs());
@@ -81,10 +81,10 @@ namespace saucer
         return rtn;
     }
 
-    void application::post(post_callback_t callback) const
+    void impl::schedule(post_callback_t callback) const
     {
         auto *message = new safe_message{std::move(callback)};
-        PostMessageW(m_impl->platform->msg_window.get(), impl::native::WM_SAFE_CALL, 0, reinterpret_cast<LPARAM>(message));
+        PostMessageW(platform->msg_window.get(), impl::native::WM_SAFE_CALL, 0, reinterpret_cast<LPARAM>(message));
     }
 
     int impl::run(application *self, callback_t callback) // NOLINT(*-static)
@@ -50,21 +50,75 @@ namespace saucer
             return stash::empty();
         }
 
-        ComPtr<IStream> stream;
+        return m_impl->cache->encoded(
+            [bitmap = m_impl->bitmap.get()]
+            {
+                ComPtr<IStream> stream;
 
-        if (!SUCCEEDED(CreateStreamOnHGlobal(nullptr, true, &stream)))
-        {
-            return stash::empty();
-        }
+                if (!SUCCEEDED(CreateStreamOnHGlobal(nullptr, true, &stream)))
+                {
+                    return stash::empty();
+                }
 
-        m_impl->bitmap->Save(stream.Get(), &png_encoder);
+                bitmap->Save(stream.Get(), &png_encoder);
 
-        LARGE_INTEGER pos;
-        pos.QuadPart = 0;
+                LARGE_INTEGER pos;
+                pos.QuadPart = 0;
 
-        stream->Seek(pos, STREAM_SEEK_SET, nullptr);
+                stream->Seek(pos, STREAM_SEEK_SET, nullptr);
+
+                return stash::from(utils::read(stream.Get()));
+            });
+    }
+
+    icon::bitmap icon::pixels() const
+    {
+        if (empty())
+        {
+            return {};
+        }
 
-        return stash::from(utils::read(stream.Get()));
+        return m_impl->cache->decoded(
+            [image = m_impl->bitmap.get()]
+            {
+                const auto width  = image->GetWidth();
+                const auto height = image->GetHeight();
+
+                auto rect = Gdiplus::Rect{0, 0, static_cast<INT>(width), static_cast<INT>(height)};
+                auto data = Gdiplus::BitmapData{};
+
+                if (image->LockBits(&rect, Gdiplus::ImageLockModeRead, PixelFormat32bppARGB, &data) != Gdiplus::Status::Ok)
+                {
+                    return bitmap{};
+                }
+
+                // GDI+ stores 32bpp ARGB as BGRA in memory, so the channels have to be swapped into a buffer of our own.
+                const auto stride = static_cast<std::size_t>(width) * 4;
+                auto rtn          = std::vector<std::uint8_t>(stride * height);
+
+                for (auto y = 0u; y < height; ++y)
+                {
+                    const auto *src = static_cast<const std::uint8_t *>(data.Scan0) + (static_cast<std::ptrdiff_t>(y) * data.Stride);
+                    auto *dst       = rtn.data() + (y * stride);
+
+                    for (auto x = 0u; x < width; ++x, src += 4, dst += 4)
+                    {
+                        dst[0] = src[2];
+                        dst[1] = src[1];
+                        dst[2] = src[0];
+                        dst[3] = src[3];
+                    }
+                }
+
+                image->UnlockBits(&data);
+
+                return bitmap{
+                    .data   = stash::from(std::move(rtn)),
+                    .width  = width,
+                    .height = height,
+                    .stride = stride,
+                };
+            });
     }
 
     void icon::save(const fs::path &path) const
@@ -1,5 +1,7 @@
 #include "win32.window.impl.hpp"
 
+#include "monitor.hpp"
+
 #include "win32.app.impl.hpp"
 
 #include <cmath>
@@ -138,7 +140,7 @@ namespace saucer
             }
 
             prev.emplace(current);
-            self->events.get<event::decorated>().fire(current);
+            utils::fire<event::decorated>(self->events, current);
 
             break;
         }
@@ -202,7 +204,7 @@ namespace saucer
             break;
         }
         case WM_NCACTIVATE:
-            self->events.get<event::focus>().fire(w_param);
+            utils::fire<event::focus>(self->events, w_param);
             break;
         case WM_SYSCOMMAND:
             if (w_param == SC_RESTORE)
@@ -212,23 +214,26 @@ namespace saucer
                 wnd_proc(hwnd, WM_SIZE, SIZE_RESTORED, -1);
             }
             break;
+        case WM_MOVE:
+            self->refresh();
+            break;
         case WM_SIZE: {
             switch (w_param)
             {
             case SIZE_MAXIMIZED:
-                self->events.get<event::maximize>().fire(true);
+                utils::fire<event::maximize>(self->events, true);
                 break;
             case SIZE_MINIMIZED:
-                self->events.get<event::minimize>().fire(true);
+                utils::fire<event::minimize>(self->events, true);
                 break;
             case SIZE_RESTORED:
                 switch (self->platform->prev_state)
                 {
                 case SIZE_MAXIMIZED:
-                    self->events.get<event::maximize>().fire(false);
+                    utils::fire<event::maximize>(self->events, false);
                     break;
                 case SIZE_MINIMIZED:
-                    self->events.get<event::minimize>().fire(false);
+                    utils::fire<event::minimize>(self->events, false);
                     break;
                 }
                 break;
@@ -246,13 +251,13 @@ namespace saucer
 
             const auto [w, h] = self->platform->scale<mode::sub>({.w = width, .h = height});
 
-            self->events.get<event::resize>().fire(w, h);
+            utils::fire<event::resize>(self->events, w, h);
             self->platform->window_target.Root().Size({static_cast<float>(width), static_cast<float>(height)});
 
             break;
         }
         case WM_CLOSE: {
-            if (self->events.get<event::close>().fire().find(policy::block))
+            if (utils::fire<event::close>(self->events).find(policy::block))
             {
                 return 0;
             }
@@ -266,7 +271,7 @@ namespace saucer
             self->hide();
 
             instances.erase(identifier);
-            self->events.get<event::closed>().fire();
+            utils::fire<event::closed>(self->events);
 
             if (!impl->quit_on_last_window_closed)
             {
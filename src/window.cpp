@@ -7,6 +7,110 @@
 
 namespace saucer
 {
+    using impl = window::impl;
+
+    static constexpr std::uint64_t pack(int first, int second)
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(first)) << 32) | static_cast<std::uint32_t>(second);
+    }
+
+    template <typename T>
+    static constexpr T unpack(std::uint64_t value)
+    {
+        return {static_cast<int>(static_cast<std::uint32_t>(value >> 32)), static_cast<int>(static_cast<std::uint32_t>(value))};
+    }
+
+    void impl::snapshot::store(const values &current)
+    {
+        // Only ever written from the main thread, an odd sequence tells readers that an update is in progress.
+
+        const auto seq = sequence.load(std::memory_order_relaxed);
+
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        visible.store(current.visible, std::memory_order_relaxed);
+        focused.store(current.focused, std::memory_order_relaxed);
+        minimized.store(current.minimized, std::memory_order_relaxed);
+        maximized.store(current.maximized, std::memory_order_relaxed);
+        size.store(pack(current.size.w, current.size.h), std::memory_order_relaxed);
+        position.store(pack(current.position.x, current.position.y), std::memory_order_relaxed);
+
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    impl::snapshot::values impl::snapshot::load() const
+    {
+        while (true)
+        {
+            const auto before = sequence.load(std::memory_order_acquire);
+
+            if (before % 2 != 0)
+            {
+                continue;
+            }
+
+            auto rtn = values{
+                .visible   = visible.load(std::memory_order_relaxed),
+                .focused   = focused.load(std::memory_order_relaxed),
+                .minimized = minimized.load(std::memory_order_relaxed),
+                .maximized = maximized.load(std::memory_order_relaxed),
+                .size      = unpack<saucer::size>(size.load(std::memory_order_relaxed)),
+                .position  = unpack<saucer::position>(position.load(std::memory_order_relaxed)),
+            };
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (sequence.load(std::memory_order_relaxed) == before)
+            {
+                return rtn;
+            }
+        }
+    }
+
+    void impl::refresh()
+    {
+        // Called on the main thread whenever the native window reports a change, so that other threads
+        // can read the most recent state without having to wait for the event loop.
+
+        state->store({
+            .visible   = visible(),
+            .focused   = focused(),
+            .minimized = minimized(),
+            .maximized = maximized(),
+            .size      = size(),
+            .position  = position(),
+        });
+
+        state->ready.store(true, std::memory_order_release);
+    }
+
+    bool impl::cached() const
+    {
+        return !parent->thread_safe() && state->ready.load(std::memory_order_acquire) &&
+               state->pending.load(std::memory_order_acquire) == 0;
+    }
+
+    template <utils::detail::callback Callback, typename... Ts>
+    void impl::update(Ts... args)
+    {
+        // Setters don't wait for the main thread, while one is in flight the snapshot is outdated and getters have to go
+        // through the queue instead, which orders them after the update.
+
+        const auto scope = instrumentation::scope{Callback.site};
+
+        state->pending.fetch_add(1, std::memory_order_acq_rel);
+
+        auto apply = [](impl *self, auto... values)
+        {
+            std::invoke(Callback.value, self, values...);
+            self->refresh();
+            self->state->pending.fetch_sub(1, std::memory_order_release);
+        };
+
+        return utils::dispatch(apply, this, args...);
+    }
+
     window::window(application *app) : m_impl(detail::make_safe<impl>(app))
     {
         m_events = &m_impl->events;
@@ -19,14 +123,57 @@ namespace saucer
             return parent->invoke(&window::create, parent);
         }
 
-        auto rtn            = std::shared_ptr<window>{new window{parent}};
-        rtn->m_impl->parent = parent;
+        auto rtn         = std::shared_ptr<window>{new window{parent}};
+        auto *const impl = rtn->m_impl.get();
+
+        impl->parent = parent;
+        impl->state  = std::make_unique<impl::snapshot>();
 
-        if (auto status = rtn->m_impl->init_platform(); !status.has_value())
+        if (auto status = impl->init_platform(); !status.has_value())
         {
             return err(status);
         }
 
+        auto refresh = [impl](auto &&...)
+        {
+            impl->refresh();
+        };
+
+        rtn->on<event::resize>({{.func = refresh, .clearable = false}});
+        rtn->on<event::maximize>({{.func = refresh, .clearable = false}});
+        rtn->on<event::minimize>({{.func = refresh, .clearable = false}});
+        rtn->on<event::focus>({{.func = refresh, .clearable = false}});
+
+        auto closed = [impl]
+        {
+            // Some backends only hide the native window after the event, but a closed window is never visible.
+            impl->refresh();
+
+            auto current    = impl->state->load();
+            current.visible = false;
+
+            impl->state->store(current);
+        };
+
+        rtn->on<event::closed>({{.func = closed, .clearable = false}});
+
+        impl->refresh();
+
+        return rtn;
+    }
+
+    coco::future<result<std::shared_ptr<window>>> window::create_async(application *parent)
+    {
+        auto promise = coco::promise<result<std::shared_ptr<window>>>{};
+        auto rtn     = promise.get_future();
+
+        auto task = [promise = std::move(promise), parent]() mutable
+        {
+            promise.set_value(create(parent));
+        };
+
+        parent->post(std::move(task), "saucer::window::create_async");
+
         return rtn;
     }
 
@@ -48,21 +195,41 @@ namespace saucer
 
     bool window::visible() const
     {
+        if (m_impl->cached())
+        {
+            return m_impl->state->load().visible;
+        }
+
         return utils::invoke<&impl::visible>(m_impl.get());
     }
 
     bool window::focused() const
     {
+        if (m_impl->cached())
+        {
+            return m_impl->state->load().focused;
+        }
+
         return utils::invoke<&impl::focused>(m_impl.get());
     }
 
     bool window::minimized() const
     {
+        if (m_impl->cached())
+        {
+            return m_impl->state->load().minimized;
+        }
+
         return utils::invoke<&impl::minimized>(m_impl.get());
     }
 
     bool window::maximized() const
     {
+        if (m_impl->cached())
+        {
+            return m_impl->state->load().maximized;
+        }
+
         return utils::invoke<&impl::maximized>(m_impl.get());
     }
 
@@ -103,6 +270,11 @@ namespace saucer
 
     size window::size() const
     {
+        if (m_impl->cached())
+        {
+            return m_impl->state->load().size;
+        }
+
         return utils::invoke<&impl::size>(m_impl.get());
     }
 
@@ -118,6 +290,11 @@ namespace saucer
 
     position window::position() const
     {
+        if (m_impl->cached())
+        {
+            return m_impl->state->load().position;
+        }
+
         return utils::invoke<&impl::position>(m_impl.get());
     }
 
@@ -128,22 +305,22 @@ namespace saucer
 
     void window::hide()
     {
-        return utils::invoke<&impl::hide>(m_impl.get());
+        return m_impl->update<&impl::hide>();
     }
 
     void window::show()
     {
-        return utils::invoke<&impl::show>(m_impl.get());
+        return m_impl->update<&impl::show>();
     }
 
     void window::close()
     {
-        return utils::invoke<&impl::close>(m_impl.get());
+        return m_impl->update<&impl::close>();
     }
 
     void window::focus()
     {
-        return utils::invoke<&impl::focus>(m_impl.get());
+        return m_impl->update<&impl::focus>();
     }
 
     void window::start_drag()
@@ -158,72 +335,72 @@ namespace saucer
 
     void window::set_minimized(bool enabled)
     {
-        return utils::invoke<&impl::set_minimized>(m_impl.get(), enabled);
+        return m_impl->update<&impl::set_minimized>(enabled);
     }
 
     void window::set_maximized(bool enabled)
     {
-        return utils::invoke<&impl::set_maximized>(m_impl.get(), enabled);
+        return m_impl->update<&impl::set_maximized>(enabled);
     }
 
     void window::set_resizable(bool enabled)
     {
-        return utils::invoke<&impl::set_resizable>(m_impl.get(), enabled);
+        return utils::dispatch<&impl::set_resizable>(m_impl.get(), enabled);
     }
 
     void window::set_fullscreen(bool enabled)
     {
-        return utils::invoke<&impl::set_fullscreen>(m_impl.get(), enabled);
+        return m_impl->update<&impl::set_fullscreen>(enabled);
     }
 
     void window::set_always_on_top(bool enabled)
     {
-        return utils::invoke<&impl::set_always_on_top>(m_impl.get(), enabled);
+        return utils::dispatch<&impl::set_always_on_top>(m_impl.get(), enabled);
     }
 
     void window::set_click_through(bool enabled)
     {
-        return utils::invoke<&impl::set_click_through>(m_impl.get(), enabled);
+        return utils::dispatch<&impl::set_click_through>(m_impl.get(), enabled);
     }
 
     void window::set_icon(const icon &icon)
     {
-        return utils::invoke<&impl::set_icon>(m_impl.get(), icon);
+        return utils::dispatch<&impl::set_icon>(m_impl.get(), icon);
     }
 
     void window::set_title(cstring_view title)
     {
-        return utils::invoke<&impl::set_title>(m_impl.get(), title);
+        return utils::dispatch<&impl::set_title>(m_impl.get(), title);
     }
 
     void window::set_background(color background)
     {
-        return utils::invoke<&impl::set_background>(m_impl.get(), background);
+        return utils::dispatch<&impl::set_background>(m_impl.get(), background);
     }
 
     void window::set_decorations(decoration decoration)
     {
-        return utils::invoke<&impl::set_decorations>(m_impl.get(), decoration);
+        return utils::dispatch<&impl::set_decorations>(m_impl.get(), decoration);
     }
 
     void window::set_size(saucer::size size)
     {
-        return utils::invoke<&impl::set_size>(m_impl.get(), size);
+        return m_impl->update<&impl::set_size>(size);
     }
 
     void window::set_max_size(saucer::size size)
     {
-        return utils::invoke<&impl::set_max_size>(m_impl.get(), size);
+        return utils::dispatch<&impl::set_max_size>(m_impl.get(), size);
     }
 
     void window::set_min_size(saucer::size size)
     {
-        return utils::invoke<&impl::set_min_size>(m_impl.get(), size);
+        return utils::dispatch<&impl::set_min_size>(m_impl.get(), size);
     }
 
     void window::set_position(saucer::position position)
     {
-        return utils::invoke<&impl::set_position>(m_impl.get(), position);
+        return m_impl->update<&impl::set_position>(position);
     }
 
     void window::off(event event)
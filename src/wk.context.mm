@@ -0,0 +1,34 @@
+#include "wk.context.impl.hpp"
+
+#include "cocoa.app.impl.hpp"
+
+namespace saucer
+{
+    using impl = context::impl;
+
+    impl::impl() = default;
+
+    impl::~impl() = default;
+
+    result<> impl::init_platform()
+    {
+        const utils::autorelease_guard guard{};
+
+        platform       = std::make_unique<native>();
+        platform->pool = [[WKProcessPool alloc] init];
+
+        if (!opts.storage_path.has_value() && !opts.persistent_cookies)
+        {
+            platform->store = utils::objc_ptr<WKWebsiteDataStore>::ref([WKWebsiteDataStore nonPersistentDataStore]);
+            return {};
+        }
+
+        const auto &id   = parent->native<false>()->platform->id;
+        auto *const uuid = utils::uuid_from(opts.storage_path.transform([](const auto &path) { return path.string(); }).value_or(id));
+
+        platform->store = utils::objc_ptr<WKWebsiteDataStore>::ref([WKWebsiteDataStore dataStoreForIdentifier:uuid]);
+        [uuid autorelease];
+
+        return {};
+    }
+} // namespace saucer
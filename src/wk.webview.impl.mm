@@ -1,8 +1,12 @@
 #include "wk.webview.impl.hpp"
 
+#include "monitor.hpp"
+
 #include "cocoa.utils.hpp"
 #include "cocoa.window.impl.hpp"
 
+#include "wk.context.impl.hpp"
+
 #include "wk.navigation.impl.hpp"
 #include "wk.permission.impl.hpp"
 
@@ -39,7 +43,7 @@ namespace saucer
                     return;
                 }
 
-                self->events.get<event::fullscreen>().fire(state == WKFullscreenStateInFullscreen).find(saucer::policy::block);
+                utils::fire<event::fullscreen>(self->events, state == WKFullscreenStateInFullscreen).find(saucer::policy::block);
             }];
 
         [web_view.get() addObserver:observer.get() forKeyPath:@"fullscreenState" options:0 context:nullptr];
@@ -63,7 +67,7 @@ namespace saucer
 
         const utils::objc_ptr<Observer> observer = [[Observer alloc] initWithCallback:[self]
                                                                      {
-                                                                         self->events.get<event::navigated>().fire(self->url());
+                                                                         utils::fire<event::navigated>(self->events, self->url());
                                                                      }];
 
         [web_view.get() addObserver:observer.get() forKeyPath:@"URL" options:0 context:nullptr];
@@ -102,7 +106,7 @@ namespace saucer
 
         const utils::objc_ptr<Observer> observer = [[Observer alloc] initWithCallback:[self]
                                                                      {
-                                                                         self->events.get<event::title>().fire(self->page_title());
+                                                                         utils::fire<event::title>(self->events, self->page_title());
                                                                      }];
 
         [web_view.get() addObserver:observer.get() forKeyPath:@"title" options:0 context:nullptr];
@@ -114,6 +118,11 @@ namespace saucer
     {
     }
 
+    template <>
+    void native::setup<event::usage>(impl *)
+    {
+    }
+
     void native::inject(const script &script) const
     {
         using enum script::time;
@@ -192,6 +201,22 @@ namespace saucer
             [target setValue:[dict objectForKey:@"value"] forKey:selector];
         }
 
+        if (opts.context.has_value())
+        {
+            using enum saucer::context::process;
+
+            const auto *context = opts.context->native<false>();
+            auto *pool          = context->platform->pool.get();
+
+            if (context->opts.policy == isolated)
+            {
+                pool = [[[WKProcessPool alloc] init] autorelease];
+            }
+
+            [config setProcessPool:pool];
+            [config setWebsiteDataStore:context->platform->store.get()];
+        }
+
         // https://github.com/WebKit/WebKit/blob/0ba313f0755d90540c9c97a08e481c192f78c295/Source/WebKit/UIProcess/API/Cocoa/WKProcessPool.mm#L219
 
 #ifdef SAUCER_WEBKIT_PRIVATE
@@ -259,20 +284,15 @@ using namespace saucer;
 
     if (message == "dom_loaded")
     {
-        me->platform->dom_loaded = true;
-
-        for (const auto &pending : me->platform->pending)
-        {
-            me->execute(pending);
-        }
+        me->dom_loaded = true;
+        me->flush();
 
-        me->platform->pending.clear();
-        me->events.get<event::dom_ready>().fire();
+        utils::fire<event::dom_ready>(me->events);
 
         return;
     }
 
-    me->events.get<event::message>().fire(message).find(status::handled);
+    utils::fire<event::message>(me->events, message).find(status::handled);
 }
 @end
 
@@ -337,7 +357,7 @@ using namespace saucer;
         .type    = type,
     });
 
-    me->events.get<event::permission>().fire(req).find(status::handled);
+    utils::fire<event::permission>(me->events, req).find(status::handled);
 }
 @end
 
@@ -352,8 +372,8 @@ using namespace saucer;
 
 - (void)webView:(WKWebView *)webview didStartProvisionalNavigation:(WKNavigation *)navigation
 {
-    me->platform->dom_loaded = false;
-    me->events.get<event::load>().fire(state::started);
+    me->dom_loaded = false;
+    utils::fire<event::load>(me->events, state::started);
 }
 
 - (void)webView:(WKWebView *)webview
@@ -366,7 +386,7 @@ using namespace saucer;
         .action = utils::objc_ptr<WKNavigationAction>::ref(action),
     }};
 
-    if (me->events.get<event::navigate>().fire(nav).find(policy::block))
+    if (utils::fire<event::navigate>(me->events, nav).find(policy::block))
     {
         return handler(WKNavigationActionPolicyCancel);
     }
@@ -376,7 +396,7 @@ using namespace saucer;
 
 - (void)webView:(WKWebView *)webview didFinishNavigation:(WKNavigation *)navigation
 {
-    me->events.get<event::load>().fire(state::finished);
+    utils::fire<event::load>(me->events, state::finished);
 }
 @end
 
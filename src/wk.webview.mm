@@ -21,6 +21,11 @@ namespace saucer
 
     impl::impl() = default;
 
+    result<> impl::launch_platform(const options &)
+    {
+        return {};
+    }
+
     result<> impl::init_platform(const options &opts)
     {
         const utils::autorelease_guard guard{};
@@ -41,12 +46,15 @@ namespace saucer
         [platform->web_view.get() setUIDelegate:platform->ui_delegate.get()];
         [platform->web_view.get() setNavigationDelegate:platform->navigation_delegate.get()];
 
-        auto *const uuid  = native::data_store_id(opts, parent->native<false>()->platform->id);
-        auto *const store = [WKWebsiteDataStore dataStoreForIdentifier:uuid];
+        if (!opts.context.has_value())
+        {
+            auto *const uuid  = native::data_store_id(opts, parent->native<false>()->platform->id);
+            auto *const store = [WKWebsiteDataStore dataStoreForIdentifier:uuid];
 
-        [uuid autorelease];
+            [uuid autorelease];
 
-        [platform->config.get() setWebsiteDataStore:store];
+            [platform->config.get() setWebsiteDataStore:store];
+        }
         [platform->config.get().preferences setElementFullscreenEnabled:YES];
 
 #ifdef SAUCER_WEBKIT_PRIVATE
@@ -170,6 +178,27 @@ namespace saucer
         };
     }
 
+    std::optional<std::uint32_t> impl::process_id() const
+    {
+        const auto guard = utils::autorelease_guard{};
+        auto *const view = platform->web_view.get();
+
+        // Not part of the public API, but available ever since `WKWebView` was introduced.
+        if (![view respondsToSelector:NSSelectorFromString(@"_webProcessIdentifier")])
+        {
+            return std::nullopt;
+        }
+
+        const auto pid = [[view valueForKey:@"_webProcessIdentifier"] intValue];
+
+        if (pid <= 0)
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<std::uint32_t>(pid);
+    }
+
     void impl::set_url(const saucer::url &url) // NOLINT(*-function-const)
     {
         const auto guard = utils::autorelease_guard{};
@@ -292,15 +321,39 @@ namespace saucer
         [platform->web_view.get() reload];
     }
 
-    void impl::execute(cstring_view code) // NOLINT(*-function-const)
+    void impl::release_memory() // NOLINT(*-function-const)
     {
         const utils::autorelease_guard guard{};
 
-        if (!platform->dom_loaded)
-        {
-            platform->pending.emplace_back(code);
-            return;
-        }
+        auto *const store = platform->web_view.get().configuration.websiteDataStore;
+        auto *const types = [NSSet setWithObject:WKWebsiteDataTypeMemoryCache];
+
+        [store removeDataOfTypes:types modifiedSince:[NSDate distantPast] completionHandler:^{}];
+    }
+
+    coco::future<void> impl::clear_cache() // NOLINT(*-function-const)
+    {
+        const utils::autorelease_guard guard{};
+
+        auto promise = std::make_shared<coco::promise<void>>();
+        auto rtn     = promise->get_future();
+
+        auto *const store = platform->web_view.get().configuration.websiteDataStore;
+        auto *const types = [NSSet setWithArray:@[WKWebsiteDataTypeMemoryCache, WKWebsiteDataTypeDiskCache]];
+
+        [store removeDataOfTypes:types
+                   modifiedSince:[NSDate distantPast]
+               completionHandler:[promise]
+               {
+                   promise->set_value();
+               }];
+
+        return rtn;
+    }
+
+    void impl::evaluate(cstring_view code) // NOLINT(*-function-const)
+    {
+        const utils::autorelease_guard guard{};
 
         [platform->web_view.get() evaluateJavaScript:[NSString stringWithUTF8String:code.c_str()] completionHandler:nil];
     }
@@ -319,6 +372,11 @@ namespace saucer
         return id;
     }
 
+    void impl::inject_builtin(const script &script)
+    {
+        inject(script);
+    }
+
     void impl::uninject()
     {
         const utils::autorelease_guard guard{};
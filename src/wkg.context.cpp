@@ -0,0 +1,138 @@
+#include "wkg.context.impl.hpp"
+
+#include "wkg.webview.impl.hpp"
+
+namespace saucer
+{
+    using impl = context::impl;
+
+    impl::impl() = default;
+
+    impl::~impl()
+    {
+        if (!platform)
+        {
+            return;
+        }
+
+        g_weak_ref_clear(&platform->related);
+    }
+
+    result<> impl::init_platform()
+    {
+        // Schemes are only registered on the default context by `webview`, so they have to be mirrored onto ours.
+        webview::impl::register_scheme("saucer");
+
+        platform = std::make_unique<native>();
+        g_weak_ref_init(&platform->related, nullptr);
+
+        const auto path = opts.storage_path.value_or(fs::current_path() / ".saucer");
+
+        if (opts.persistent_cookies)
+        {
+            platform->session = webkit_network_session_new((path / "data").c_str(), (path / "cache").c_str());
+
+            auto *const manager = webkit_network_session_get_cookie_manager(platform->session.get());
+            webkit_cookie_manager_set_persistent_storage(manager, (path / "cookies").c_str(), WEBKIT_COOKIE_PERSISTENT_STORAGE_SQLITE);
+        }
+        else
+        {
+            platform->session = webkit_network_session_new_ephemeral();
+        }
+
+        auto *const data_manager = webkit_network_session_get_website_data_manager(platform->session.get());
+        webkit_website_data_manager_set_favicons_enabled(data_manager, true);
+
+        platform->context = native::make_context(opts.memory);
+        platform->extension = webview::impl::native::load_extension(platform->context.get());
+
+        auto *const security = webkit_web_context_get_security_manager(platform->context.get());
+        auto callback        = reinterpret_cast<WebKitURISchemeRequestCallback>(&scheme::handler::handle);
+
+        for (const auto &[name, handler] : webview::impl::native::schemes)
+        {
+            webkit_web_context_register_uri_scheme(platform->context.get(), name.c_str(), callback, handler.get(), nullptr);
+
+            webkit_security_manager_register_uri_scheme_as_secure(security, name.c_str());
+            webkit_security_manager_register_uri_scheme_as_cors_enabled(security, name.c_str());
+        }
+
+        return {};
+    }
+
+    WebKitWebContext *impl::native::make_context(const std::optional<limits> &config)
+    {
+        if (!config.has_value())
+        {
+            return webkit_web_context_new();
+        }
+
+        auto *const settings = webkit_memory_pressure_settings_new();
+
+        if (config->memory.has_value())
+        {
+            webkit_memory_pressure_settings_set_memory_limit(settings, static_cast<guint>(*config->memory));
+        }
+
+        if (config->poll_interval.has_value())
+        {
+            webkit_memory_pressure_settings_set_poll_interval(settings, std::chrono::duration<double>{*config->poll_interval}.count());
+        }
+
+        if (config->conservative.has_value())
+        {
+            webkit_memory_pressure_settings_set_conservative_threshold(settings, *config->conservative);
+        }
+
+        if (config->strict.has_value())
+        {
+            webkit_memory_pressure_settings_set_strict_threshold(settings, *config->strict);
+        }
+
+        if (config->kill.has_value())
+        {
+            webkit_memory_pressure_settings_set_kill_threshold(settings, *config->kill);
+        }
+
+        // The settings are only read on construction, the context keeps its own copy.
+        auto *const rtn = g_object_new(WEBKIT_TYPE_WEB_CONTEXT, "memory-pressure-settings", settings, nullptr);
+        webkit_memory_pressure_settings_free(settings);
+
+        return WEBKIT_WEB_CONTEXT(rtn);
+    }
+
+    WebKitWebView *impl::native::make_view(process policy, WebKitSettings *settings)
+    {
+        auto *const previous = policy == process::shared ? g_weak_ref_get(&related) : nullptr;
+        WebKitWebView *rtn{};
+
+        if (previous)
+        {
+            // A related view is placed into the same web process and inherits the web context and network session. It would
+            // also inherit the settings and user content manager, which would leak scripts and messages between webviews.
+
+            auto *const manager = webkit_user_content_manager_new();
+
+            rtn = WEBKIT_WEB_VIEW(g_object_new(WEBKIT_TYPE_WEB_VIEW,                //
+                                               "related-view", previous,            //
+                                               "settings", settings,                //
+                                               "user-content-manager", manager,     //
+                                               nullptr));
+
+            g_object_unref(manager);
+            g_object_unref(previous);
+        }
+        else
+        {
+            rtn = WEBKIT_WEB_VIEW(g_object_new(WEBKIT_TYPE_WEB_VIEW,                //
+                                               "web-context", context.get(),        //
+                                               "network-session", session.get(),    //
+                                               "settings", settings,                //
+                                               nullptr));
+        }
+
+        g_weak_ref_set(&related, rtn);
+
+        return rtn;
+    }
+} // namespace saucer
@@ -7,6 +7,7 @@
 
 #include "gtk.icon.impl.hpp"
 #include "gtk.window.impl.hpp"
+#include "wkg.context.impl.hpp"
 #include "wkg.scheme.impl.hpp"
 
 #include <cassert>
@@ -17,13 +18,30 @@ namespace saucer
 
     impl::impl() = default;
 
-    result<> impl::init_platform(const options &opts)
+    result<> impl::launch_platform(const options &opts)
     {
-        platform = std::make_unique<native>();
+        // Constructing the web view already launches its web-process, which then starts up while the event-loop moves on.
 
-        platform->web_view = WEBKIT_WEB_VIEW(webkit_web_view_new());
+        platform           = std::make_unique<native>();
         platform->settings = native::make_settings(opts);
 
+        if (opts.context.has_value())
+        {
+            auto *const context = opts.context->native<false>();
+            platform->web_view  = context->platform->make_view(context->opts.policy, platform->settings.get());
+            platform->extension = context->platform->extension;
+        }
+        else
+        {
+            if (opts.process_extension)
+            {
+                static const auto loaded = native::load_extension(webkit_web_context_get_default());
+                platform->extension      = loaded;
+            }
+
+            platform->web_view = WEBKIT_WEB_VIEW(webkit_web_view_new());
+        }
+
         const auto acceleration = opts.hardware_acceleration ? WEBKIT_HARDWARE_ACCELERATION_POLICY_ALWAYS //
                                                              : WEBKIT_HARDWARE_ACCELERATION_POLICY_NEVER;
 
@@ -36,12 +54,17 @@ namespace saucer
 
         webkit_web_view_set_settings(platform->web_view, platform->settings.get());
 
+        return {};
+    }
+
+    result<> impl::init_platform(const options &opts)
+    {
         auto *const session      = webkit_web_view_get_network_session(platform->web_view);
         auto *const data_manager = webkit_network_session_get_website_data_manager(session);
 
         webkit_website_data_manager_set_favicons_enabled(data_manager, true);
 
-        if (opts.persistent_cookies)
+        if (opts.persistent_cookies && !opts.context.has_value())
         {
             auto *const manager = webkit_network_session_get_cookie_manager(session);
             auto path           = opts.storage_path.value_or(fs::current_path() / ".saucer");
@@ -51,6 +74,8 @@ namespace saucer
         platform->id_context = utils::connect(platform->web_view, "context-menu", native::on_context, this);
         platform->id_load    = utils::connect(platform->web_view, "load-changed", native::on_load, this);
 
+        platform->id_user_message = utils::connect(platform->web_view, "user-message-received", native::on_user_message, this);
+
         // The ContentManager is ref'd to prevent it from being destroyed early when using multiple webviews
         platform->manager = content_manager_ptr::ref(webkit_web_view_get_user_content_manager(platform->web_view));
         webkit_user_content_manager_register_script_message_handler(platform->manager.get(), "saucer", nullptr);
@@ -80,6 +105,14 @@ namespace saucer
             return;
         }
 
+        if (!platform->manager)
+        {
+            // Only launched but never set up, the web view was not handed to the window and still holds a floating reference
+            g_object_ref_sink(platform->web_view);
+            g_object_unref(platform->web_view);
+            return;
+        }
+
         for (const auto &[name, _] : native::schemes)
         {
             remove_scheme(name);
@@ -87,6 +120,7 @@ namespace saucer
 
         g_signal_handler_disconnect(platform->web_view, platform->id_context);
         g_signal_handler_disconnect(platform->web_view, platform->id_load);
+        g_signal_handler_disconnect(platform->web_view, platform->id_user_message);
 
         g_signal_handler_disconnect(platform->manager.get(), platform->id_message);
 
@@ -123,7 +157,16 @@ namespace saucer
 
     icon impl::favicon() const
     {
-        return icon::impl{utils::g_object_ptr<GdkTexture>::ref(webkit_web_view_get_favicon(platform->web_view))};
+        auto *const texture = webkit_web_view_get_favicon(platform->web_view);
+        auto &cached        = platform->favicon;
+
+        // WebKit keeps handing out the same texture until the favicon changes, reusing the icon keeps its encodings cached.
+        if (!cached.has_value() || cached->native<false>()->texture.get() != texture)
+        {
+            cached.emplace(icon::impl{utils::g_object_ptr<GdkTexture>::ref(texture)});
+        }
+
+        return cached.value();
     }
 
     std::string impl::page_title() const
@@ -186,6 +229,12 @@ namespace saucer
         };
     }
 
+    std::optional<std::uint32_t> impl::process_id() const
+    {
+        // Reported by our web process extension once the page is created, see `src/extension/webkitgtk.cpp`.
+        return platform->pid;
+    }
+
     void impl::set_url(const saucer::url &url) // NOLINT(*-function-const)
     {
         webkit_web_view_load_uri(platform->web_view, url.string().c_str());
@@ -274,28 +323,43 @@ namespace saucer
         webkit_web_view_reload(platform->web_view);
     }
 
-    void impl::execute(cstring_view code) // NOLINT(*-function-const)
+    void impl::release_memory() // NOLINT(*-function-const)
     {
-        if (!platform->dom_loaded)
-        {
-            platform->pending.emplace_back(code);
-            return;
-        }
+        auto *const session = webkit_web_view_get_network_session(platform->web_view);
+        auto *const manager = webkit_network_session_get_website_data_manager(session);
 
-        webkit_web_view_evaluate_javascript(platform->web_view, code.c_str(), -1, nullptr, nullptr, nullptr, nullptr, nullptr);
+        webkit_website_data_manager_clear(manager, WEBKIT_WEBSITE_DATA_MEMORY_CACHE, 0, nullptr, nullptr, nullptr);
     }
 
-    std::size_t impl::inject(const script &script) // NOLINT(*-function-const)
+    coco::future<void> impl::clear_cache() // NOLINT(*-function-const)
     {
-        using enum script::time;
+        auto promise = std::make_unique<coco::promise<void>>();
+        auto rtn     = promise->get_future();
 
-        const auto time = (script.run_at == creation) ? WEBKIT_USER_SCRIPT_INJECT_AT_DOCUMENT_START //
-                                                      : WEBKIT_USER_SCRIPT_INJECT_AT_DOCUMENT_END;
+        auto *const session = webkit_web_view_get_network_session(platform->web_view);
+        auto *const manager = webkit_network_session_get_website_data_manager(session);
 
-        const auto frame = (script.no_frames) ? WEBKIT_USER_CONTENT_INJECT_TOP_FRAME //
-                                              : WEBKIT_USER_CONTENT_INJECT_ALL_FRAMES;
+        auto callback = [](GObject *object, GAsyncResult *result, gpointer data)
+        {
+            auto promise = std::unique_ptr<coco::promise<void>>{static_cast<coco::promise<void> *>(data)};
+            webkit_website_data_manager_clear_finish(WEBKIT_WEBSITE_DATA_MANAGER(object), result, nullptr);
+            promise->set_value();
+        };
+
+        const auto types = WEBKIT_WEBSITE_DATA_MEMORY_CACHE | WEBKIT_WEBSITE_DATA_DISK_CACHE;
+        webkit_website_data_manager_clear(manager, static_cast<WebKitWebsiteDataTypes>(types), 0, nullptr, +callback, promise.release());
+
+        return rtn;
+    }
+
+    void impl::evaluate(cstring_view code) // NOLINT(*-function-const)
+    {
+        webkit_web_view_evaluate_javascript(platform->web_view, code.c_str(), -1, nullptr, nullptr, nullptr, nullptr, nullptr);
+    }
 
-        auto *const user_script = webkit_user_script_new(script.code.c_str(), frame, time, nullptr, nullptr);
+    std::size_t impl::inject(const script &script) // NOLINT(*-function-const)
+    {
+        auto *const user_script = native::make_script(script.code, script.run_at, script.no_frames);
         const auto id           = platform->id_counter++;
 
         webkit_user_content_manager_add_script(platform->manager.get(), user_script);
@@ -304,6 +368,25 @@ namespace saucer
         return id;
     }
 
+    void impl::inject_builtin(const script &script) // NOLINT(*-function-const)
+    {
+        // Only used for our own scripts, which are trusted and never removed. They are all injected while the webview is being
+        // created, i.e. before any user script, so re-adding the merged script keeps them in front.
+
+        auto &bundle = platform->builtins[{script.run_at, script.no_frames}];
+
+        if (bundle.ref)
+        {
+            webkit_user_content_manager_remove_script(platform->manager.get(), bundle.ref.get());
+        }
+
+        bundle.code += script.code;
+        bundle.code += "\n;\n";
+
+        bundle.ref = native::make_script(bundle.code, script.run_at, script.no_frames);
+        webkit_user_content_manager_add_script(platform->manager.get(), bundle.ref.get());
+    }
+
     void impl::uninject() // NOLINT(*-function-const)
     {
         for (auto it = platform->scripts.begin(); it != platform->scripts.end();)
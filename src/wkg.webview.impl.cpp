@@ -1,13 +1,21 @@
 #include "wkg.webview.impl.hpp"
 
+#include "monitor.hpp"
+
 #include "gtk.window.impl.hpp"
 #include "wkg.scheme.impl.hpp"
 
 #include "wkg.navigation.impl.hpp"
 #include "wkg.permission.impl.hpp"
 
+#include <ranges>
 #include <cassert>
+#include <vector>
+#include <cstdlib>
 #include <optional>
+#include <algorithm>
+#include <filesystem>
+#include <string_view>
 
 #include <json-glib/json-glib.h>
 
@@ -103,7 +111,7 @@ namespace saucer
                 .type    = type,
             });
 
-            self->events.get<event::permission>().fire(req).find(status::handled);
+            utils::fire<event::permission>(self->events, req).find(status::handled);
         };
 
         const auto id = utils::connect(web_view, "permission-request", +callback, self);
@@ -122,12 +130,12 @@ namespace saucer
 
         auto enter_callback = [](WebKitWebView *, impl *self) -> gboolean
         {
-            return self->events.get<event::fullscreen>().fire(true).find(policy::block).has_value();
+            return utils::fire<event::fullscreen>(self->events, true).find(policy::block).has_value();
         };
 
         auto leave_callback = [](WebKitWebView *, impl *self) -> gboolean
         {
-            return self->events.get<event::fullscreen>().fire(false).find(policy::block).has_value();
+            return utils::fire<event::fullscreen>(self->events, false).find(policy::block).has_value();
         };
 
         const auto enter = utils::connect(web_view, "enter-fullscreen", +enter_callback, self);
@@ -175,7 +183,7 @@ namespace saucer
                 .type     = type,
             }};
 
-            if (self->events.get<event::navigate>().fire(nav).find(policy::block))
+            if (utils::fire<event::navigate>(self->events, nav).find(policy::block))
             {
                 webkit_policy_decision_ignore(raw);
                 return true;
@@ -219,7 +227,7 @@ namespace saucer
                 assert(false);
             }
 
-            self->events.get<event::request>().fire(unwrap_safe(parsed));
+            utils::fire<event::request>(self->events, unwrap_safe(parsed));
         };
 
         const auto id = utils::connect(web_view, "resource-load-started", +callback, self);
@@ -238,7 +246,7 @@ namespace saucer
 
         auto callback = [](void *, GParamSpec *, impl *self)
         {
-            self->events.get<event::favicon>().fire(self->favicon());
+            utils::fire<event::favicon>(self->events, self->favicon());
         };
 
         const auto id = utils::connect(web_view, "notify::favicon", +callback, self);
@@ -257,7 +265,7 @@ namespace saucer
 
         auto callback = [](void *, GParamSpec *, impl *self)
         {
-            self->events.get<event::title>().fire(self->page_title());
+            utils::fire<event::title>(self->events, self->page_title());
         };
 
         const auto id = utils::connect(web_view, "notify::title", +callback, self);
@@ -269,6 +277,11 @@ namespace saucer
     {
     }
 
+    template <>
+    void native::setup<event::usage>(impl *)
+    {
+    }
+
     gboolean native::on_context(WebKitWebView *, WebKitContextMenu *, WebKitHitTestResult *, impl *self)
     {
         return !self->platform->context_menu;
@@ -280,33 +293,35 @@ namespace saucer
 
         if (message == "dom_loaded")
         {
-            self->platform->dom_loaded = true;
+            self->dom_loaded = true;
+            self->flush();
 
-            for (const auto &pending : self->platform->pending)
-            {
-                self->execute(pending);
-            }
-
-            self->platform->pending.clear();
-            self->events.get<event::dom_ready>().fire();
+            utils::fire<event::dom_ready>(self->events);
 
             return;
         }
 
-        self->events.get<event::message>().fire(message).find(status::handled);
+        utils::fire<event::message>(self->events, message).find(status::handled);
     }
 
     void native::on_load(WebKitWebView *, WebKitLoadEvent event, impl *self)
     {
         if (event == WEBKIT_LOAD_COMMITTED)
         {
-            self->events.get<event::navigated>().fire(self->url());
+            utils::fire<event::navigated>(self->events, self->url());
             return;
         }
 
         if (event == WEBKIT_LOAD_FINISHED)
         {
-            self->events.get<event::load>().fire(state::finished);
+            // The pid is reported when the page is created, if it is still missing the extension failed to load.
+            if (static auto warned{false}; self->platform->extension && !self->platform->pid.has_value() && !warned)
+            {
+                g_warning("saucer: The web process extension did not report in, process ids will not be reported");
+                warned = true;
+            }
+
+            utils::fire<event::load>(self->events, state::finished);
             return;
         }
 
@@ -315,8 +330,21 @@ namespace saucer
             return;
         }
 
-        self->platform->dom_loaded = false;
-        self->events.get<event::load>().fire(state::started);
+        self->dom_loaded = false;
+        utils::fire<event::load>(self->events, state::started);
+    }
+
+    gboolean native::on_user_message(WebKitWebView *, WebKitUserMessage *message, impl *self)
+    {
+        if (std::string_view{webkit_user_message_get_name(message)} != "saucer:pid")
+        {
+            return false;
+        }
+
+        // Sent for every page that is created, which also covers process swaps and crashed web processes being replaced.
+        self->platform->pid = g_variant_get_uint32(webkit_user_message_get_parameters(message));
+
+        return true;
     }
 
     void native::on_click(GtkGestureClick *gesture, gint, gdouble, gdouble, impl *self)
@@ -343,6 +371,65 @@ namespace saucer
         previous.reset();
     }
 
+    WebKitUserScript *native::make_script(const std::string &code, script::time run_at, bool no_frames)
+    {
+        using enum script::time;
+
+        const auto time = (run_at == creation) ? WEBKIT_USER_SCRIPT_INJECT_AT_DOCUMENT_START //
+                                               : WEBKIT_USER_SCRIPT_INJECT_AT_DOCUMENT_END;
+
+        const auto frame = no_frames ? WEBKIT_USER_CONTENT_INJECT_TOP_FRAME //
+                                     : WEBKIT_USER_CONTENT_INJECT_ALL_FRAMES;
+
+        return webkit_user_script_new(code.c_str(), frame, time, nullptr, nullptr);
+    }
+
+    static std::optional<fs::path> extension_directory()
+    {
+        // The extension is looked up in the directory given at runtime, the build tree and finally the install location.
+
+        std::vector<fs::path> candidates;
+
+        if (const auto *const env = std::getenv("SAUCER_EXTENSION_PATH"); env && *env)
+        {
+            candidates.emplace_back(env);
+        }
+
+        candidates.emplace_back(SAUCER_EXTENSION_PATH);
+        candidates.emplace_back(SAUCER_EXTENSION_INSTALL_PATH);
+
+        auto exists = [](const fs::path &directory)
+        {
+            std::error_code ec{};
+            return fs::exists(directory / SAUCER_EXTENSION_NAME, ec);
+        };
+
+        if (auto it = std::ranges::find_if(candidates, exists); it != candidates.end())
+        {
+            return *it;
+        }
+
+        return std::nullopt;
+    }
+
+    bool native::load_extension(WebKitWebContext *context)
+    {
+        const auto directory = extension_directory();
+
+        if (!directory.has_value())
+        {
+            g_warning("saucer: Could not find the web process extension (%s), process ids will not be reported. Set "
+                      "SAUCER_EXTENSION_PATH to the directory containing it.",
+                      SAUCER_EXTENSION_NAME);
+
+            return false;
+        }
+
+        webkit_web_context_set_web_process_extensions_directory(context, directory->c_str());
+
+        return true;
+    }
+
     WebKitSettings *native::make_settings(const options &opts)
     {
         std::vector<GValue> values;
@@ -0,0 +1,51 @@
+#include "workers.hpp"
+
+#include <algorithm>
+
+namespace saucer::utils
+{
+    workers::workers()
+    {
+        const auto count = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+
+        for (auto i = 0u; i < count; ++i)
+        {
+            m_threads.emplace_back([this](const std::stop_token &token) { work(token); });
+        }
+    }
+
+    void workers::work(const std::stop_token &token)
+    {
+        while (true)
+        {
+            auto lock = std::unique_lock{m_mutex};
+
+            if (!m_condition.wait(lock, token, [this] { return !m_tasks.empty(); }))
+            {
+                return;
+            }
+
+            auto task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+
+            lock.unlock();
+            task();
+        }
+    }
+
+    void workers::submit(task_t task)
+    {
+        {
+            std::lock_guard guard{m_mutex};
+            m_tasks.emplace_back(std::move(task));
+        }
+
+        m_condition.notify_one();
+    }
+
+    workers &workers::shared()
+    {
+        static workers rtn;
+        return rtn;
+    }
+} // namespace saucer::utils
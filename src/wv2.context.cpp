@@ -0,0 +1,30 @@
+#include "wv2.context.impl.hpp"
+
+#include "wv2.webview.impl.hpp"
+
+namespace saucer
+{
+    using impl = context::impl;
+
+    impl::impl() = default;
+
+    impl::~impl()
+    {
+        if (!platform || !platform->cleanup.has_value())
+        {
+            return;
+        }
+
+        // Every webview holds on to its context, so all of them (and their controllers) are gone by now.
+        platform->environment.Reset();
+
+        webview::impl::native::remove_user_folder(platform->browser_pid, *platform->cleanup);
+    }
+
+    result<> impl::init_platform()
+    {
+        // All webviews of an environment share one browser process, renderer processes are assigned by Chromium per site.
+        platform = std::make_unique<native>();
+        return {};
+    }
+} // namespace saucer
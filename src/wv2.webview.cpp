@@ -3,6 +3,7 @@
 #include "win32.error.hpp"
 #include "win32.app.impl.hpp"
 #include "win32.window.impl.hpp"
+#include "wv2.context.impl.hpp"
 
 #include "scripts.hpp"
 
@@ -24,6 +25,11 @@ namespace saucer
 
     impl::impl() = default;
 
+    result<> impl::launch_platform(const options &)
+    {
+        return {};
+    }
+
     result<> impl::init_platform(const options &opts)
     {
         auto env_options = native::env_options();
@@ -55,16 +61,28 @@ namespace saucer
             return err(storage_path);
         }
 
-        auto environment = native::create_environment(parent, {
-                                                                  .storage_path = *storage_path,
-                                                                  .opts         = env_options.Get(),
-                                                              });
+        auto *const context = opts.context.has_value() ? opts.context->native<false>()->platform.get() : nullptr;
+        auto environment    = result<ComPtr<ICoreWebView2Environment>>{context ? context->environment : nullptr};
+        const auto created  = !*environment;
+
+        if (created)
+        {
+            environment = native::create_environment(parent, {
+                                                                 .storage_path = *storage_path,
+                                                                 .opts         = env_options.Get(),
+                                                             });
+        }
 
         if (!environment.has_value())
         {
             return err(environment);
         }
 
+        if (context)
+        {
+            context->environment = *environment;
+        }
+
         auto *const parent_window = window->native<false>()->platform.get();
         auto *const hwnd          = parent_window->hwnd.get();
 
@@ -91,14 +109,20 @@ namespace saucer
 
         platform = std::make_unique<native>();
 
-        platform->controller = std::move(*controller);
-        platform->web_view   = std::move(web_view);
-        platform->lease      = utils::lease<webview::impl *>{this};
+        platform->controller  = std::move(*controller);
+        platform->web_view    = std::move(web_view);
+        platform->environment = *environment;
+        platform->lease       = utils::lease<webview::impl *>{this};
+        platform->context     = opts.context;
 
-        if (!opts.storage_path.has_value() && !opts.persistent_cookies)
+        if (!opts.storage_path.has_value() && !opts.persistent_cookies && created)
         {
-            platform->cleanup = *storage_path;
-            platform->web_view->get_BrowserProcessId(&platform->browser_pid);
+            // A shared environment outlives this webview, its temporary folder is removed by the context instead.
+            auto &owner = context ? context->cleanup : platform->cleanup;
+            auto &pid   = context ? context->browser_pid : platform->browser_pid;
+
+            owner = *storage_path;
+            platform->web_view->get_BrowserProcessId(&pid);
         }
 
         platform->web_view->get_Settings(&platform->settings);
@@ -129,6 +153,17 @@ namespace saucer
         platform->web_view->add_DOMContentLoaded(Callback<DOMLoaded>(bind(&native::on_dom)).Get(), nullptr);
         platform->web_view->add_FaviconChanged(Callback<FaviconChanged>(bind(&native::on_favicon)).Get(), nullptr);
 
+        if (ComPtr<ICoreWebView2Environment8> env; SUCCEEDED(platform->environment.As(&env)))
+        {
+            // The environment may be shared through a context, so the handler has to be removed again once we're gone.
+            EventRegistrationToken token;
+
+            env->add_ProcessInfosChanged(Callback<ProcessesChanged>(bind(&native::on_processes)).Get(), &token);
+            platform->processes_changed = token;
+        }
+
+        native::on_processes(this, nullptr, nullptr);
+
         auto on_resize = [this, parent_window](int, int)
         {
             if (!platform->bounds.has_value())
@@ -150,8 +185,19 @@ namespace saucer
             platform->controller->put_IsVisible(!minimized);
         };
 
+        auto on_focus = [this](bool focused)
+        {
+            if (!focused)
+            {
+                return;
+            }
+
+            native::restore_memory(this);
+        };
+
         platform->on_resize   = native::bound_events--;
         platform->on_minimize = native::bound_events--;
+        platform->on_focus    = native::bound_events--;
 
         auto &events = window->native<false>()->events;
 
@@ -165,6 +211,11 @@ namespace saucer
                                                                                 .clearable = false,
                                                                             }});
 
+        events.get<window::event::focus>().update(platform->on_focus, {{
+                                                                          .func      = on_focus,
+                                                                          .clearable = false,
+                                                                      }});
+
         on_resize(0, 0);
         on_minimize(window->minimized());
 
@@ -180,6 +231,12 @@ namespace saucer
 
         window->off(window::event::resize, platform->on_resize);
         window->off(window::event::minimize, platform->on_minimize);
+        window->off(window::event::focus, platform->on_focus);
+
+        if (ComPtr<ICoreWebView2Environment8> env; platform->processes_changed && SUCCEEDED(platform->environment.As(&env)))
+        {
+            env->remove_ProcessInfosChanged(*platform->processes_changed);
+        }
 
         platform->controller->Close();
 
@@ -188,15 +245,7 @@ namespace saucer
             return;
         }
 
-        // Using `ICoreWebView2Environment5`s `add_BrowserProcessExited` sadly doesn't play that nice
-        // with this architecture, as we need to have the main-loop running to receive the event,
-        // but by that time, the application destructor has mostly been called already...
-
-        utils::process_handle handle = OpenProcess(SYNCHRONIZE, false, platform->browser_pid);
-        WaitForSingleObject(handle.get(), 1000);
-
-        std::error_code ec{};
-        fs::remove_all(*platform->cleanup, ec);
+        native::remove_user_folder(platform->browser_pid, *platform->cleanup);
     }
 
     template <webview::event Event>
@@ -292,6 +341,11 @@ namespace saucer
         return unwrap_safe(platform->bounds);
     }
 
+    std::optional<std::uint32_t> impl::process_id() const
+    {
+        return platform->renderer;
+    }
+
     void impl::set_url(const saucer::url &url) // NOLINT(*-function-const)
     {
         platform->web_view->Navigate(utils::widen(url.string()).c_str());
@@ -371,14 +425,47 @@ namespace saucer
         platform->web_view->Reload();
     }
 
-    void impl::execute(cstring_view code) // NOLINT(*-function-const)
+    void impl::release_memory() // NOLINT(*-function-const)
     {
-        if (!platform->dom_loaded)
+        // Dropping the target level makes the browser trim the webview's memory. Restoring it right away would let the browser
+        // skip the trim, so the low level is kept until the webview is used again (see `native::restore_memory`).
+        platform->trimmed = true;
+        platform->web_view->put_MemoryUsageTargetLevel(COREWEBVIEW2_MEMORY_USAGE_TARGET_LEVEL_LOW);
+    }
+
+    coco::future<void> impl::clear_cache() // NOLINT(*-function-const)
+    {
+        auto promise = std::make_shared<coco::promise<void>>();
+        auto rtn     = promise->get_future();
+
+        ComPtr<ICoreWebView2Profile> profile;
+        ComPtr<ICoreWebView2Profile2> profile2;
+
+        if (!SUCCEEDED(platform->web_view->get_Profile(&profile)) || !SUCCEEDED(profile.As(&profile2)))
         {
-            platform->pending.emplace_back(code);
-            return;
+            promise->set_value();
+            return rtn;
+        }
+
+        auto callback = [promise](HRESULT)
+        {
+            promise->set_value();
+            return S_OK;
+        };
+
+        const auto kinds = static_cast<COREWEBVIEW2_BROWSING_DATA_KINDS>(COREWEBVIEW2_BROWSING_DATA_KINDS_DISK_CACHE |
+                                                                         COREWEBVIEW2_BROWSING_DATA_KINDS_CACHE_STORAGE);
+
+        if (!SUCCEEDED(profile2->ClearBrowsingData(kinds, Callback<DataCleared>(callback).Get())))
+        {
+            promise->set_value();
         }
 
+        return rtn;
+    }
+
+    void impl::evaluate(cstring_view code) // NOLINT(*-function-const)
+    {
         platform->web_view->ExecuteScript(utils::widen(code).c_str(), nullptr);
     }
 
@@ -423,6 +510,11 @@ namespace saucer
         return id;
     }
 
+    void impl::inject_builtin(const script &script)
+    {
+        inject(script);
+    }
+
     void impl::uninject() // NOLINT(*-function-const)
     {
         static constexpr auto uninject = static_cast<void (impl::*)(std::size_t)>(&impl::uninject);
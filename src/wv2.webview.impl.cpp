@@ -1,5 +1,7 @@
 #include "wv2.webview.impl.hpp"
 
+#include "monitor.hpp"
+
 #include "win32.error.hpp"
 #include "win32.app.impl.hpp"
 #include "win32.icon.impl.hpp"
@@ -12,6 +14,7 @@
 
 #include <format>
 #include <ranges>
+#include <utility>
 
 #include <winerror.h>
 
@@ -52,7 +55,7 @@ namespace saucer
 
             auto fire = [req](impl *self)
             {
-                self->events.get<event::permission>().fire(req).find(status::handled);
+                utils::fire<event::permission>(self->events, req).find(status::handled);
             };
 
             self->parent->post(utils::defer(self->platform->lease, fire));
@@ -92,7 +95,7 @@ namespace saucer
 
             auto fire = [url](impl *self)
             {
-                self->events.get<event::navigated>().fire(url);
+                utils::fire<event::navigated>(self->events, url);
             };
 
             self->parent->post(utils::defer(self->platform->lease, fire));
@@ -139,7 +142,13 @@ namespace saucer
         auto handler = [self](auto...)
         {
             auto title = self->page_title();
-            self->parent->post(utils::defer(self->platform->lease, [title](impl *self) { self->events.get<event::title>().fire(title); }));
+
+            auto fire = [title](impl *self)
+            {
+                utils::fire<event::title>(self->events, title);
+            };
+
+            self->parent->post(utils::defer(self->platform->lease, fire));
 
             return S_OK;
         };
@@ -162,7 +171,7 @@ namespace saucer
 
         static constexpr auto fire = [](impl *self)
         {
-            self->events.get<event::load>().fire(state::finished);
+            utils::fire<event::load>(self->events, state::finished);
         };
 
         auto handler = [self](auto...)
@@ -177,6 +186,11 @@ namespace saucer
         event.on_clear([this, token] { web_view->remove_NavigationCompleted(token); });
     }
 
+    template <>
+    void native::setup<event::usage>(impl *)
+    {
+    }
+
     ComPtr<ICoreWebView2EnvironmentOptions> native::env_options()
     {
         static auto instance = Make<CoreWebView2EnvironmentOptions>();
@@ -195,6 +209,19 @@ namespace saucer
         return fs::temp_directory_path() / std::format(L"saucer-{}", *hash);
     }
 
+    void native::remove_user_folder(std::uint32_t browser_pid, const fs::path &folder)
+    {
+        // Using `ICoreWebView2Environment5`s `add_BrowserProcessExited` sadly doesn't play that nice
+        // with this architecture, as we need to have the main-loop running to receive the event,
+        // but by that time, the application destructor has mostly been called already...
+
+        utils::process_handle handle = OpenProcess(SYNCHRONIZE, false, browser_pid);
+        WaitForSingleObject(handle.get(), 1000);
+
+        std::error_code ec{};
+        fs::remove_all(folder, ec);
+    }
+
     result<ComPtr<ICoreWebView2Environment>> native::create_environment(application *parent, const environment_options &options)
     {
         ComPtr<ICoreWebView2Environment> rtn{};
@@ -261,7 +288,7 @@ namespace saucer
 
         auto fire = [message = std::move(message)](impl *self)
         {
-            self->events.get<event::message>().fire(message).find(status::handled);
+            utils::fire<event::message>(self->events, message).find(status::handled);
         };
 
         self->parent->post(utils::defer(self->platform->lease, fire));
@@ -292,7 +319,7 @@ namespace saucer
             return S_OK;
         }
 
-        self->events.get<event::request>().fire(*parsed);
+        utils::fire<event::request>(self->events, *parsed);
 
         return scheme_handler(self, {.raw = args, .request = std::move(request), .url = std::move(*parsed)});
     }
@@ -301,7 +328,7 @@ namespace saucer
     {
         using enum script::time;
 
-        self->platform->dom_loaded = true;
+        self->dom_loaded = true;
 
         for (const auto &[id, script] : self->platform->scripts)
         {
@@ -310,16 +337,11 @@ namespace saucer
                 continue;
             }
 
-            self->execute(script.code);
+            self->evaluate(script.code);
         }
 
-        for (const auto &pending : self->platform->pending)
-        {
-            self->execute(pending);
-        }
-
-        self->platform->pending.clear();
-        self->parent->post(utils::defer(self->platform->lease, [](impl *self) { self->events.get<event::dom_ready>().fire(); }));
+        self->flush();
+        self->parent->post(utils::defer(self->platform->lease, [](impl *self) { utils::fire<event::dom_ready>(self->events); }));
 
         return S_OK;
     }
@@ -328,17 +350,19 @@ namespace saucer
     {
         static constexpr auto fire = [](impl *self)
         {
-            self->events.get<event::load>().fire(state::started);
+            utils::fire<event::load>(self->events, state::started);
         };
 
-        self->platform->dom_loaded = false;
+        self->dom_loaded = false;
         self->parent->post(utils::defer(self->platform->lease, fire));
 
+        restore_memory(self);
+
         auto nav = navigation{navigation::impl{
             .request = args,
         }};
 
-        if (self->events.get<event::navigate>().fire(nav).find(policy::block))
+        if (utils::fire<event::navigate>(self->events, nav).find(policy::block))
         {
             args->put_Cancel(true);
         }
@@ -346,6 +370,16 @@ namespace saucer
         return S_OK;
     }
 
+    void native::restore_memory(impl *self)
+    {
+        if (!std::exchange(self->platform->trimmed, false))
+        {
+            return;
+        }
+
+        self->platform->web_view->put_MemoryUsageTargetLevel(COREWEBVIEW2_MEMORY_USAGE_TARGET_LEVEL_NORMAL);
+    }
+
     HRESULT native::on_favicon(impl *self, ICoreWebView2 *, IUnknown *)
     {
         auto callback = [self](auto, auto *stream)
@@ -354,7 +388,7 @@ namespace saucer
                 std::shared_ptr<Gdiplus::Bitmap>(Gdiplus::Bitmap::FromStream(stream)),
             }};
 
-            self->events.get<event::favicon>().fire(self->platform->favicon);
+            utils::fire<event::favicon>(self->events, self->platform->favicon);
 
             return S_OK;
         };
@@ -362,6 +396,80 @@ namespace saucer
         return self->platform->web_view->GetFavicon(COREWEBVIEW2_FAVICON_IMAGE_FORMAT_PNG, Callback<GetFavicon>(callback).Get());
     }
 
+    HRESULT native::on_processes(impl *self, ICoreWebView2Environment *, IUnknown *)
+    {
+        // Renderers are swapped on cross-site navigations and restarted after crashes, so the lookup is repeated on every change.
+
+        ComPtr<ICoreWebView2Environment13> environment;
+        UINT32 frame{};
+
+        if (auto status = self->platform->environment.As(&environment); !SUCCEEDED(status))
+        {
+            return status;
+        }
+
+        if (auto status = self->platform->web_view->get_FrameId(&frame); !SUCCEEDED(status))
+        {
+            return status;
+        }
+
+        auto callback = utils::defer(self->platform->lease,
+                                     [frame](impl *owner, HRESULT, ICoreWebView2ProcessExtendedInfoCollection *processes)
+                                     {
+                                         owner->platform->renderer = find_renderer(processes, frame);
+                                         return S_OK;
+                                     });
+
+        return environment->GetProcessExtendedInfos(Callback<GetProcesses>(callback).Get());
+    }
+
+    std::optional<std::uint32_t> native::find_renderer(ICoreWebView2ProcessExtendedInfoCollection *processes, UINT32 frame)
+    {
+        UINT count{};
+
+        if (!processes || !SUCCEEDED(processes->get_Count(&count)))
+        {
+            return std::nullopt;
+        }
+
+        for (auto i = 0u; count > i; ++i)
+        {
+            ComPtr<ICoreWebView2ProcessExtendedInfo> process;
+            ComPtr<ICoreWebView2FrameInfoCollection> frames;
+            ComPtr<ICoreWebView2FrameInfoCollectionIterator> it;
+
+            if (!SUCCEEDED(processes->GetValueAtIndex(i, &process)) || !SUCCEEDED(process->get_AssociatedFrameInfos(&frames)) ||
+                !SUCCEEDED(frames->GetIterator(&it)))
+            {
+                continue;
+            }
+
+            for (BOOL current{}; SUCCEEDED(it->get_HasCurrent(&current)) && current; it->MoveNext(&current))
+            {
+                ComPtr<ICoreWebView2FrameInfo> info;
+                ComPtr<ICoreWebView2FrameInfo2> info2;
+                UINT32 id{};
+
+                if (!SUCCEEDED(it->GetCurrent(&info)) || !SUCCEEDED(info.As(&info2)) || !SUCCEEDED(info2->get_FrameId(&id)) || id != frame)
+                {
+                    continue;
+                }
+
+                ComPtr<ICoreWebView2ProcessInfo> details;
+                INT32 pid{};
+
+                if (!SUCCEEDED(process->get_ProcessInfo(&details)) || !SUCCEEDED(details->get_ProcessId(&pid)))
+                {
+                    return std::nullopt;
+                }
+
+                return static_cast<std::uint32_t>(pid);
+            }
+        }
+
+        return std::nullopt;
+    }
+
     HRESULT native::on_fullscreen(impl *self, ICoreWebView2 *, IUnknown *)
     {
         BOOL fullscreen{false};
@@ -371,7 +479,7 @@ namespace saucer
             return status;
         }
 
-        if (!self->events.get<event::fullscreen>().fire(fullscreen).find(policy::block))
+        if (!utils::fire<event::fullscreen>(self->events, fullscreen).find(policy::block))
         {
             self->window->set_fullscreen(fullscreen);
         }
@@ -394,7 +502,7 @@ namespace saucer
                 .request = args,
             }};
 
-            self->events.get<event::navigate>().fire(nav).find(policy::block);
+            utils::fire<event::navigate>(self->events, nav).find(policy::block);
             deferral->Complete();
         };
 
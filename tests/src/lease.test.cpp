@@ -0,0 +1,61 @@
+#include "test.hpp"
+#include "utils.hpp"
+
+#include <lease.hpp>
+
+#include <atomic>
+#include <thread>
+#include <optional>
+
+using namespace boost::ut;
+using namespace saucer::tests;
+
+suite<"lease"> lease_suite = []
+{
+    static constexpr auto duration = std::chrono::seconds(5);
+
+    "lease"_test_async = [](saucer::window &)
+    {
+        auto value  = 42;
+        auto lease  = std::optional<saucer::utils::lease<int *>>{std::in_place, &value};
+        auto rental = lease->rent();
+
+        {
+            const auto lock = rental.access();
+            expect(lock.value() != nullptr and **lock.value() == 42);
+        }
+
+        auto deferred = saucer::utils::defer(*lease, [](int *current) { return *current + 1; });
+        expect(eq(deferred(), 43));
+
+        auto borrowed = std::atomic_bool{false};
+        auto revoked  = std::atomic_bool{false};
+        auto overlap  = std::atomic_bool{false};
+
+        auto borrower = std::jthread{[&]
+                                     {
+                                         const auto lock = rental.access();
+                                         borrowed        = true;
+
+                                         std::this_thread::sleep_for(std::chrono::milliseconds{100});
+                                         overlap = revoked.load();
+                                     }};
+
+        wait_for([&borrowed] { return borrowed.load(); }, duration);
+        expect(borrowed.load());
+
+        // Revoking has to wait for the rental that is still accessing the value.
+        lease.reset();
+        revoked = true;
+
+        borrower.join();
+        expect(not overlap.load());
+
+        // New rentals (and deferred callbacks) fail once the lease is gone.
+        expect(rental.access().value() == nullptr);
+        expect(eq(deferred(), 0));
+
+        auto copy = rental;
+        expect(copy.access().value() == nullptr);
+    };
+};
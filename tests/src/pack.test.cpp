@@ -0,0 +1,52 @@
+#include "test.hpp"
+
+#include <saucer/pack.hpp>
+
+#include <fstream>
+#include <filesystem>
+
+using namespace boost::ut;
+
+suite<"pack"> pack_suite = []
+{
+    "pack"_test_async = [](saucer::window &)
+    {
+        auto files = saucer::pack::open(SAUCER_TEST_PACK);
+
+        expect(files.has_value());
+        expect(eq(files->size(), std::size_t{3}));
+
+        auto &index = files->at("/index.html");
+
+        expect(index.mime == "text/html");
+        expect(index.content.str() == "<!DOCTYPE html>\n<html></html>\n");
+
+        auto &style = files->at("/nested/style.css");
+
+        expect(style.mime == "text/css");
+        expect(style.content.str() == "body { margin: 0; }\n");
+
+        // Files without a known extension are sniffed when packing.
+        auto &document = files->at("/document");
+
+        expect(document.mime == "application/pdf");
+        expect(document.content.str() == "%PDF-1.7\n");
+    };
+
+    "pack-invalid"_test_async = [](saucer::window &)
+    {
+        namespace fs = std::filesystem;
+
+        const auto file = fs::temp_directory_path() / "saucer-invalid.pack";
+
+        {
+            auto stream = std::ofstream{file, std::ios::binary | std::ios::trunc};
+            stream << "SAUCERPK";
+        }
+
+        expect(not saucer::pack::open(file).has_value());
+        expect(not saucer::pack::open(file.parent_path() / "saucer-missing.pack").has_value());
+
+        fs::remove(file);
+    };
+};
@@ -0,0 +1,58 @@
+#include "test.hpp"
+#include "utils.hpp"
+
+#include <preload.hpp>
+
+#include <vector>
+#include <optional>
+#include <filesystem>
+
+using namespace boost::ut;
+using namespace saucer::tests;
+
+suite<"preload"> preload_suite = []
+{
+    static constexpr auto duration = std::chrono::seconds(5);
+
+    "preload"_test_async = [](saucer::window &)
+    {
+        namespace fs = std::filesystem;
+        using saucer::utils::preloader;
+
+        const auto root = fs::temp_directory_path() / "saucer-preload-test";
+        fs::remove_all(root);
+
+        {
+            auto first  = std::optional<preloader>{std::in_place, root};
+            auto second = std::optional<preloader>{std::in_place, root};
+
+            first->document("/a.html");
+            first->resource("/a.css");
+
+            second->document("/b.html");
+            second->resource("/b.js");
+            second->resource("/b.css");
+
+            // Recordings are stored once the next document is requested, or the preloader goes away.
+            first.reset();
+            second.reset();
+        }
+
+        const auto stored = [&]
+        {
+            return fs::exists(preloader::file(root, "/a.html")) && fs::exists(preloader::file(root, "/b.html"));
+        };
+
+        wait_for(stored, duration);
+        expect(stored());
+
+        // Views sharing a storage path must not overwrite each others recordings.
+        auto loaded = preloader{root};
+
+        expect(loaded.order("/a.html") == std::vector<fs::path>{"/a.css"});
+        expect(loaded.order("/b.html") == std::vector<fs::path>{"/b.js", "/b.css"});
+        expect(loaded.order("/c.html").empty());
+
+        fs::remove_all(root);
+    };
+};
@@ -1,6 +1,22 @@
 #include "test.hpp"
 #include "utils.hpp"
 
+#include <saucer/icon.hpp>
+#include <saucer/assets.hpp>
+#include <saucer/trace.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <format>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+
 using namespace boost::ut;
 using namespace saucer::tests;
 
@@ -8,6 +24,14 @@ suite<"regression"> regression_suite = []
 {
     static constexpr auto duration = std::chrono::seconds(10);
 
+    // A 2x1 PNG with an opaque red and a half-transparent blue pixel
+    static constexpr auto png = std::to_array<std::uint8_t>({
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x08, 0x06, 0x00, 0x00, 0x00, 0xf4, 0x22, 0x7f, 0x8a, 0x00, 0x00, 0x00,
+        0x0e, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0x63, 0xf8, 0xcf, 0xc0, 0x00, 0x42, 0x0d, 0x00, 0x0f, 0x7a, 0x03,
+        0x7e, 0x77, 0xe9, 0x7f, 0x97, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    });
+
     "script-order"_test_async = [](saucer::smartview &webview)
     {
         using enum saucer::script::time;
@@ -53,4 +77,291 @@ suite<"regression"> regression_suite = []
         expect(eq(order.at(2), 3));
         expect(eq(order.at(3), 4));
     };
+
+    "post-order"_test_async = [](saucer::window &window)
+    {
+        // Callbacks posted from the same thread must run in order, even when they are drained in several batches.
+
+        static constexpr auto count = 10000;
+
+        auto &app  = window.parent();
+        auto order = std::vector<int>{};
+
+        for (auto i = 0; i < count; ++i)
+        {
+            app.post([&order, i] { order.emplace_back(i); });
+        }
+
+        auto done = std::atomic_bool{false};
+        app.post([&done] { done = true; });
+
+        saucer::tests::wait_for([&done] { return done.load(); }, duration);
+
+        expect(eq(order.size(), std::size_t{count}));
+        expect(std::ranges::is_sorted(order));
+    };
+
+    "post-lifetime"_test_async = [](saucer::window &window)
+    {
+        auto &app = window.parent();
+
+        auto other = make<saucer::window>{}();
+        auto hold  = std::atomic_bool{true};
+        auto done  = std::atomic_bool{false};
+
+        // The window is destroyed on the main thread while a setter for it is still queued, which must then be skipped.
+        app.post([&hold] { hold.wait(true); });
+        app.post([&other] { other.reset(); });
+
+        other->set_title("destroyed");
+
+        app.post([&done] { done = true; });
+
+        hold = false;
+        hold.notify_all();
+
+        saucer::tests::wait_for([&done] { return done.load(); }, duration);
+        expect(done.load());
+
+#ifdef __cpp_exceptions
+        auto caught   = std::atomic_bool{false};
+        const auto id = app.on<saucer::application::event::exception>([&caught](const std::exception_ptr &) { caught = true; });
+
+        // Exceptions thrown by callbacks nobody waits for are reported instead of terminating the loop.
+        app.dispatch([] { throw std::runtime_error{"posted"}; });
+
+        saucer::tests::wait_for([&caught] { return caught.load(); }, duration);
+        expect(caught.load());
+
+        app.off(saucer::application::event::exception, id);
+#endif
+    };
+
+    "watchdog"_test_async = [](saucer::window &window)
+    {
+        using saucer::watchdog::origin;
+
+        auto &app    = window.parent();
+        auto stalled = std::atomic_bool{false};
+        auto blocked = std::atomic_bool{false};
+
+        auto callback = [&stalled, &blocked](const saucer::watchdog::stall &stall)
+        {
+            if (stall.kind == origin::loop)
+            {
+                blocked = true;
+            }
+
+            if (stall.kind != origin::task)
+            {
+                return;
+            }
+
+            stalled = true;
+        };
+
+        app.watch({.threshold = std::chrono::milliseconds{20}, .callback = callback});
+
+        // The heartbeat is armed by the queued task, its probe then has to wait for the task to finish.
+        app.post([] { std::this_thread::sleep_for(std::chrono::milliseconds{100}); });
+        saucer::tests::wait_for([&] { return stalled.load() && blocked.load(); }, duration);
+
+        app.unwatch();
+
+        expect(stalled.load());
+        expect(blocked.load());
+        expect(app.stalls().task > 0);
+        expect(app.stalls().loop > 0);
+        expect(app.stalls().longest >= std::chrono::milliseconds{100});
+    };
+
+    "trace"_test_async = [](saucer::window &window)
+    {
+        const auto file = std::filesystem::temp_directory_path() / "saucer-trace.json";
+
+        saucer::trace::start();
+
+        // The second call is only made to ensure that the span of the first one has been recorded
+        std::ignore = window.title();
+        std::ignore = window.title();
+
+        // Names are truncated on a code-point boundary, the two byte sequence would otherwise be cut in half.
+        const auto padding = std::string(62, 'a');
+        const auto name    = padding + "\xc3\xa9";
+        {
+            const auto span = saucer::trace::span{"test", name};
+        }
+
+        saucer::trace::stop();
+
+        expect(saucer::trace::flush(file).has_value());
+
+        auto stream  = std::ifstream{file};
+        auto content = std::string{std::istreambuf_iterator<char>{stream}, {}};
+
+        expect(content.starts_with(R"({"displayTimeUnit":"ms","traceEvents":[)"));
+        expect(content.contains(R"("name":"saucer::window::title","cat":"invoke")"));
+        expect(content.contains(std::format(R"("name":"{}","cat":"test")", padding)));
+
+        std::filesystem::remove(file);
+    };
+
+    "icon-cache"_test_async = [](saucer::window &)
+    {
+        auto icon = saucer::icon::from(saucer::stash::view(png));
+        expect(icon.has_value());
+
+        const auto copy = icon.value();
+
+        // Copies share the encoded bytes instead of encoding the icon again
+        expect(icon->data().data() == copy.data().data());
+
+        const auto pixels = copy.pixels();
+
+        expect(eq(pixels.width, std::size_t{2}));
+        expect(eq(pixels.height, std::size_t{1}));
+        expect(pixels.stride >= 8);
+        expect(pixels.data.size() >= pixels.stride);
+
+        const auto *data = pixels.data.data();
+
+        expect(eq(data[0], 255) and eq(data[1], 0) and eq(data[2], 0) and eq(data[3], 255));
+        expect(eq(data[4], 0) and eq(data[7], 128));
+    };
+
+    "icon-async"_test_async = [](saucer::window &)
+    {
+        using enum saucer::icon::caching;
+
+        auto first  = saucer::icon::from_async(saucer::stash::view(png), content).get();
+        auto second = saucer::icon::from_async(saucer::stash::view(png), content).get();
+
+        expect(first.has_value() and second.has_value());
+
+        // Both results come from the same decoded icon, which also shares its encoding.
+        expect(first->data().data() == second->data().data());
+
+        auto invalid = saucer::icon::from_async(saucer::stash::from_str("not an image")).get();
+        expect(not invalid.has_value());
+
+        saucer::icon::purge();
+    };
+
+    "stash-prefetch"_test_async = [](saucer::window &)
+    {
+        static constexpr auto count = 64;
+
+        const auto caller = std::this_thread::get_id();
+        auto produced     = std::atomic_size_t{0};
+        auto off_thread   = std::atomic_size_t{0};
+
+        auto stashes = std::vector<saucer::stash>{};
+
+        for (auto i = 0; i < count; ++i)
+        {
+            stashes.emplace_back(saucer::stash::async(
+                [&, i]
+                {
+                    off_thread += std::this_thread::get_id() != caller;
+                    produced++;
+
+                    return saucer::stash::from_str(std::to_string(i));
+                }));
+        }
+
+        // The values are produced without anybody asking for them.
+        wait_for([&produced] { return produced.load() == count; }, duration);
+
+        expect(eq(produced.load(), std::size_t{count}));
+        expect(eq(off_thread.load(), std::size_t{count}));
+
+        for (auto i = 0; i < count; ++i)
+        {
+            expect(stashes[i].str() == std::to_string(i));
+        }
+
+        expect(eq(produced.load(), std::size_t{count}));
+
+#ifdef __cpp_exceptions
+        auto failing = saucer::stash::async([]() -> saucer::stash { throw std::runtime_error{"producer"}; });
+
+        // The exception is kept and handed to every reader.
+        expect(throws([&failing] { std::ignore = failing.data(); }));
+        expect(throws([&failing] { std::ignore = failing.size(); }));
+#endif
+    };
+
+    "stash-slice"_test_async = [](saucer::window &)
+    {
+        auto owner = std::make_shared<const std::string>("hello world");
+        auto weak  = std::weak_ptr{owner};
+
+        auto shared = saucer::stash::share(owner, {reinterpret_cast<const std::uint8_t *>(owner->data()), owner->size()});
+        owner.reset();
+
+        // The stash keeps its owner alive on its own.
+        expect(not weak.expired());
+        expect(shared.str() == "hello world");
+
+        auto slice = shared.slice(6);
+
+        expect(slice.str() == "world");
+        expect(slice.data() == shared.data() + 6);
+
+        // Out of bounds offsets and lengths are clamped instead of overflowing.
+        expect(shared.slice(6, 100).str() == "world");
+        expect(eq(shared.slice(100).size(), std::size_t{0}));
+        expect(eq(shared.slice(11, 1).size(), std::size_t{0}));
+
+        // Slices share ownership, so the owner lives until the last one is gone.
+        shared = saucer::stash::empty();
+        expect(not weak.expired());
+
+        slice = saucer::stash::empty();
+        expect(weak.expired());
+
+        auto owning = saucer::stash::from_str("shared buffer");
+        auto copy   = owning;
+
+        expect(copy.data() == owning.data());
+        expect(owning.slice(7).str() == "buffer");
+
+        expect(saucer::stash::view_str("view value").slice(5, 3).str() == "val");
+        expect(saucer::stash::lazy([] { return saucer::stash::from_str("lazy value"); }).slice(5).str() == "value");
+    };
+
+    "assets-interning"_test_async = [](saucer::window &)
+    {
+        static constexpr std::string_view content = "static content";
+
+        auto produced = std::atomic_size_t{0};
+
+        auto lazy = [&produced]
+        {
+            return saucer::stash::lazy(
+                [&produced]
+                {
+                    produced++;
+                    return saucer::stash::from_str("lazy content");
+                });
+        };
+
+        auto set = saucer::assets::from({
+            {"/view", {.content = saucer::stash::view_str(content), .mime = "text/plain"}},
+            {"/first", {.content = lazy(), .mime = "text/plain"}},
+            {"/second", {.content = lazy(), .mime = "text/plain"}},
+        });
+
+        // Interning must neither produce lazy contents nor copy views.
+        expect(eq(produced.load(), std::size_t{0}));
+        expect(set.find("/view")->content.data() == reinterpret_cast<const std::uint8_t *>(content.data()));
+
+        // Equal contents are merged once they are looked up.
+        auto first  = set.find("/first")->content;
+        auto second = set.find("/second")->content;
+
+        expect(eq(produced.load(), std::size_t{2}));
+        expect(first.data() == second.data());
+        expect(second.str() == "lazy content");
+    };
 };
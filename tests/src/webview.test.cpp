@@ -1,6 +1,14 @@
 #include "test.hpp"
 #include "utils.hpp"
 
+#include <atomic>
+#include <fstream>
+
+#include <saucer/pool.hpp>
+#include <saucer/scheme/cache.hpp>
+#include <saucer/scheme/router.hpp>
+#include <saucer/scheme/directory.hpp>
+
 using namespace boost::ut;
 using namespace saucer::tests;
 
@@ -108,6 +116,32 @@ suite<"webview"> webview_suite = []
         expect(webview.url().host() == "codeberg.org");
     };
 
+    "execute-batch"_test_async = [](saucer::webview &webview)
+    {
+        std::set<std::string> messages;
+        webview.on<message>(
+            [&](auto value)
+            {
+                messages.emplace(std::move(value));
+                return saucer::status::unhandled;
+            });
+
+        webview.set_url("https://codeberg.org");
+
+        // Neither syntax errors nor exceptions may leak into the other snippets.
+        webview.execute("saucer.internal.message('first')");
+        webview.execute("this is not javascript (");
+        webview.execute("throw new Error('isolated')");
+        webview.execute("const second = \"second\";\nsaucer.internal.message(second)");
+        webview.execute("const third = 'third'; saucer.internal.message(third)");
+
+        saucer::tests::wait_for([&] { return messages.contains("first") && messages.contains("third"); }, duration);
+
+        expect(messages.contains("first"));
+        expect(messages.contains("second"));
+        expect(messages.contains("third"));
+    };
+
     "inject"_test_async = [](saucer::webview &webview)
     {
         std::set<std::string> messages;
@@ -288,4 +322,400 @@ suite<"webview"> webview_suite = []
 
         expect(not scheme);
     };
+
+    "directory"_test_async = [](saucer::webview &webview)
+    {
+        static constexpr auto duration = std::chrono::seconds(3);
+
+        std::set<std::string> messages;
+        webview.on<message>(
+            [&](auto value)
+            {
+                messages.emplace(std::move(value));
+                return saucer::status::unhandled;
+            });
+
+        static constexpr auto page = [](std::string_view message)
+        {
+            return std::format(R"html(
+                <!DOCTYPE html>
+                <html>
+                    <head>
+                        <script>
+                            saucer.internal.message("{}");
+                        </script>
+                    </head>
+                </html>
+            )html",
+                               message);
+        };
+
+        // Without the watcher, cache hits have to be revalidated with a `stat` instead.
+        for (const auto watch : {true, false})
+        {
+            const auto root = std::filesystem::temp_directory_path() / std::format("saucer-{}", saucer::tests::random_string(10));
+            std::filesystem::create_directories(root);
+
+            const auto first  = std::format("first-{}", watch);
+            const auto second = std::format("second-{}", watch);
+
+            std::ofstream{root / "index.html"} << page(first);
+
+            webview.handle_scheme("test", saucer::scheme::directory{{.root = root, .watch = watch}});
+            webview.set_url(saucer::url::make({.scheme = "test", .host = "host", .path = "/"}));
+
+            saucer::tests::wait_for([&] { return messages.contains(first); }, duration);
+            expect(messages.contains(first));
+
+            std::ofstream{root / "index.html"} << page(second);
+
+            webview.reload();
+            saucer::tests::wait_for([&] { return messages.contains(second); }, duration);
+
+            expect(messages.contains(second));
+
+            webview.remove_scheme("test");
+            std::filesystem::remove_all(root);
+        }
+    };
+
+    "router"_test_async = [](saucer::webview &webview)
+    {
+        static constexpr auto duration = std::chrono::seconds(3);
+
+        std::set<std::string> messages;
+        webview.on<message>(
+            [&](auto value)
+            {
+                messages.emplace(std::move(value));
+                return saucer::status::unhandled;
+            });
+
+        static constexpr auto page = [](std::string_view message)
+        {
+            return std::format(R"html(
+                <!DOCTYPE html>
+                <html>
+                    <head>
+                        <script>
+                            saucer.internal.message("{}");
+                        </script>
+                    </head>
+                </html>
+            )html",
+                               message);
+        };
+
+        auto router = saucer::scheme::router{};
+
+        router.add("GET", "/users/:id/files/*rest",
+                   [](const saucer::scheme::request &, const saucer::scheme::route &route)
+                   {
+                       expect(route.param("id") == "42");
+                       expect(route.param("rest") == "a/b.html");
+
+                       return saucer::scheme::response{
+                           .data = saucer::stash::from_str(page(std::format("{}:{}", *route.param("id"), *route.param("rest")))),
+                           .mime = "text/html",
+                       };
+                   });
+
+        router.add("GET", "/users/me/files/*rest",
+                   [](const saucer::scheme::request &, const saucer::scheme::route &)
+                   {
+                       return saucer::scheme::response{
+                           .data = saucer::stash::from_str(R"html(
+                                <!DOCTYPE html>
+                                <html>
+                                    <head>
+                                        <script>
+                                            saucer.internal.message("me");
+                                            fetch("/users/me/files/c", { method: "POST" })
+                                                .then((res) => res.text())
+                                                .then((text) => saucer.internal.message(text));
+                                        </script>
+                                    </head>
+                                </html>
+                            )html"),
+                           .mime = "text/html",
+                       };
+                   });
+
+        router.add("POST", "/users/:id/files/*rest",
+                   [](const saucer::scheme::request &, const saucer::scheme::route &route)
+                   {
+                       return saucer::scheme::response{
+                           .data = saucer::stash::from_str(std::format("post:{}", *route.param("id"))),
+                           .mime = "text/plain",
+                       };
+                   });
+
+        webview.handle_scheme("test", std::move(router));
+
+        webview.set_url(saucer::url::make({.scheme = "test", .host = "host", .path = "/users/42/files/a/b.html"}));
+        saucer::tests::wait_for([&] { return messages.contains("42:a/b.html"); }, duration);
+
+        expect(messages.contains("42:a/b.html"));
+
+        webview.set_url(saucer::url::make({.scheme = "test", .host = "host", .path = "/users/me/files/c"}));
+        saucer::tests::wait_for([&] { return messages.contains("me"); }, duration);
+
+        expect(messages.contains("me"));
+
+        saucer::tests::wait_for([&] { return messages.contains("post:me"); }, duration);
+        expect(messages.contains("post:me"));
+
+        webview.remove_scheme("test");
+    };
+
+    "cache"_test_async = [](saucer::webview &webview)
+    {
+        static constexpr auto duration = std::chrono::seconds(3);
+
+        std::size_t loaded{0};
+        webview.on<message>(
+            [&](auto value)
+            {
+                loaded += value == "cached";
+                return saucer::status::unhandled;
+            });
+
+        static constexpr std::string_view page = R"html(
+                <!DOCTYPE html>
+                <html>
+                    <head>
+                        <script>
+                            saucer.internal.message("cached");
+                        </script>
+                    </head>
+                </html>
+            )html";
+
+        auto computed = std::make_shared<std::atomic_size_t>(0);
+
+        auto cache = saucer::scheme::cache{[computed](const saucer::scheme::request &req)
+                                           {
+                                               if (req.url().path() == "/index.html")
+                                               {
+                                                   ++*computed;
+                                               }
+
+                                               return saucer::scheme::response{
+                                                   .data = saucer::stash::view_str(page),
+                                                   .mime = "text/html",
+                                               };
+                                           },
+                                           {}};
+
+        webview.handle_scheme("test", auto{cache});
+        webview.set_url(saucer::url::make({.scheme = "test", .host = "host", .path = "/index.html"}));
+
+        saucer::tests::wait_for([&] { return loaded == 1; }, duration);
+        expect(loaded == 1);
+
+        webview.reload();
+        saucer::tests::wait_for([&] { return loaded == 2; }, duration);
+
+        expect(loaded == 2);
+        expect(computed->load() == 1);
+        expect(cache.metrics().hits >= 1);
+
+        cache.invalidate();
+
+        webview.reload();
+        saucer::tests::wait_for([&] { return loaded == 3; }, duration);
+
+        expect(computed->load() == 2);
+
+        webview.remove_scheme("test");
+    };
+
+    "assets"_test_async = [](saucer::webview &webview)
+    {
+        static constexpr auto duration = std::chrono::seconds(3);
+
+        bool loaded{false};
+        webview.on<message>(
+            [&](auto value)
+            {
+                loaded |= value == "assets";
+                return saucer::status::unhandled;
+            });
+
+        static constexpr std::string_view page = R"html(
+                <!DOCTYPE html>
+                <html>
+                    <head>
+                        <script>
+                            saucer.internal.message("assets");
+                        </script>
+                    </head>
+                </html>
+            )html";
+
+        auto make = []
+        {
+            return saucer::assets::from({{"/assets.html", {.content = saucer::stash::from_str(page), .mime = "text/html"}}});
+        };
+
+        const auto first  = make();
+        const auto second = make();
+
+        expect(first.size() == 1);
+        expect(second.contains("/assets.html"));
+        expect(first.find("/assets.html")->content.data() == second.find("/assets.html")->content.data());
+
+        webview.embed(first);
+        webview.serve("/assets.html");
+
+        saucer::tests::wait_for([&] { return loaded; }, duration);
+        expect(loaded);
+
+        loaded = false;
+        webview.unembed(first);
+
+        webview.reload();
+        saucer::tests::wait_for([&] { return loaded; }, duration);
+
+        expect(not loaded);
+        webview.unembed();
+    };
+
+    "pool"_test_async = [](saucer::webview &webview)
+    {
+        auto &app = webview.parent().parent();
+        auto pool = saucer::pool<saucer::smartview>::create(&app, {.capacity = 2});
+
+        saucer::tests::wait_for([&pool] { return pool.available() == 2; }, duration);
+        expect(eq(pool.available(), std::size_t{2}));
+
+        auto entry = pool.take();
+
+        expect(entry.has_value());
+        expect(&entry->webview.parent() == entry->window.get());
+
+        // The taken entry is replaced in the background
+        saucer::tests::wait_for([&pool] { return pool.available() == 2; }, duration);
+        expect(eq(pool.available(), std::size_t{2}));
+    };
+
+    "context"_test_async = [](saucer::webview &webview)
+    {
+        auto &app    = webview.parent().parent();
+        auto context = saucer::context::create(&app, {.persistent_cookies = false});
+
+        expect(context.has_value());
+
+        auto first  = saucer::webview::create({.window = make<saucer::window>{}(), .context = context.value()});
+        auto second = saucer::webview::create({.window = make<saucer::window>{}(), .context = context.value()});
+
+        expect(first.has_value() and second.has_value());
+
+        auto loaded = std::atomic_size_t{0};
+
+        for (auto *view : {&first.value(), &second.value()})
+        {
+            view->on<load>([&loaded](const saucer::state &state) { loaded += state == saucer::state::finished; });
+            view->set_html("<html><body>context</body></html>");
+        }
+
+        saucer::tests::wait_for([&loaded] { return loaded.load() == 2; }, duration);
+        expect(eq(loaded.load(), std::size_t{2}));
+    };
+
+    "context-isolation"_test_async = [](saucer::webview &webview)
+    {
+        auto &app    = webview.parent().parent();
+        auto context = saucer::context::create(&app, {.persistent_cookies = false});
+
+        expect(context.has_value());
+
+        auto first  = saucer::webview::create({.window = make<saucer::window>{}(), .context = context.value()});
+        auto second = saucer::webview::create({.window = make<saucer::window>{}(), .context = context.value()});
+
+        expect(first.has_value() and second.has_value());
+
+        // Webviews sharing a context (and possibly a web process) must still keep their scripts and messages apart
+        std::set<std::string> messages[2];
+
+        auto setup = [](saucer::webview &view, std::set<std::string> &received, std::string_view name)
+        {
+            view.on<message>(
+                [&received](auto value)
+                {
+                    received.emplace(std::move(value));
+                    return saucer::status::handled;
+                });
+
+            view.inject({
+                .code   = std::format("saucer.internal.message('{}')", name),
+                .run_at = saucer::script::time::ready,
+            });
+
+            view.set_html("<html><body>isolation</body></html>");
+        };
+
+        setup(first.value(), messages[0], "first");
+        setup(second.value(), messages[1], "second");
+
+        saucer::tests::wait_for([&messages] { return messages[0].contains("first") and messages[1].contains("second"); }, duration);
+
+        expect(messages[0].contains("first"));
+        expect(messages[1].contains("second"));
+
+        expect(not messages[0].contains("second"));
+        expect(not messages[1].contains("first"));
+    };
+
+    "memory"_test_async = [](saucer::webview &webview)
+    {
+        auto &app    = webview.parent().parent();
+        auto context = saucer::context::create(&app, {.persistent_cookies = false, .memory = saucer::context::limits{.memory = 512}});
+
+        expect(context.has_value());
+
+        auto view = saucer::webview::create({.window = make<saucer::window>{}(), .context = context.value()});
+        expect(view.has_value());
+
+        auto loaded = std::atomic_bool{false};
+
+        view->on<load>([&loaded](const saucer::state &state) { loaded = state == saucer::state::finished; });
+        view->set_html("<html><body>memory</body></html>");
+
+        saucer::tests::wait_for([&loaded] { return loaded.load(); }, duration);
+        expect(loaded.load());
+
+        view->release_memory();
+        view->clear_cache().get();
+
+        loaded = false;
+        view->set_html("<html><body>reloaded</body></html>");
+
+        saucer::tests::wait_for([&loaded] { return loaded.load(); }, duration);
+        expect(loaded.load());
+    };
+
+    "usage"_test_async = [](saucer::webview &)
+    {
+        auto view = saucer::webview::create({
+            .window            = make<saucer::window>{}(),
+            .sample_interval   = std::chrono::milliseconds{50},
+            .process_extension = true,
+        });
+        expect(view.has_value());
+
+        auto samples = std::atomic_size_t{0};
+        view->on<usage>([&samples](const saucer::usage &sample) { samples += sample.resident > 0; });
+
+        view->set_html("<html><body>usage</body></html>");
+        saucer::tests::wait_for([&samples] { return samples.load() >= 2; }, duration);
+
+        expect(samples.load() >= 2);
+
+        const auto pid    = view->process_id();
+        const auto sample = view->usage();
+
+        expect(pid.has_value());
+        expect(sample.has_value() and sample->process == pid);
+    };
 };
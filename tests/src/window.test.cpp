@@ -1,6 +1,9 @@
 #include "test.hpp"
 #include "utils.hpp"
 
+#include <atomic>
+#include <algorithm>
+
 using namespace boost::ut;
 using namespace saucer::tests;
 
@@ -95,6 +98,62 @@ suite<"window"> window_suite = []
         expect(eq(window.title(), title));
     };
 
+    "defer"_test_async = [](saucer::window &window)
+    {
+        auto title = saucer::tests::random_string(10);
+        window.set_title(std::string{title});
+
+        auto done     = std::atomic_bool{false};
+        auto observed = std::string{};
+
+        window.parent().defer(
+            [&]
+            {
+                observed = window.title();
+                done     = true;
+            });
+
+        saucer::tests::wait_for([&] { return done.load(); });
+
+        expect(eq(observed, title));
+        expect(eq(window.title(), title));
+    };
+
+    "create-async"_test_async = [](saucer::window &window)
+    {
+        auto &app = window.parent();
+
+        // All windows are requested before any of them is awaited
+        auto first  = saucer::window::create_async(&app);
+        auto second = saucer::window::create_async(&app);
+
+        auto parent = first.get().value();
+
+        // Both webviews are launched before either of them is set up
+        auto left  = saucer::smartview::create_async({.window = parent});
+        auto right = saucer::smartview::create_async({.window = parent});
+
+        expect(second.get().has_value());
+        expect(left.get().has_value());
+        expect(right.get().has_value());
+    };
+
+#ifdef SAUCER_INSTRUMENTATION
+    "instrumentation"_test_async = [](saucer::window &window)
+    {
+        saucer::instrumentation::reset();
+
+        std::ignore = window.title();
+        std::ignore = window.title();
+
+        auto hops = saucer::instrumentation::snapshot();
+        auto hop  = std::ranges::find_if(hops, [](const auto &hop) { return hop.site.ends_with("window::title"); });
+
+        expect(fatal(hop != hops.end()));
+        expect(eq(hop->calls, std::size_t{2}));
+    };
+#endif
+
 #ifndef SAUCER_WEBKITGTK
     "background"_test_both = [](saucer::window &window)
     {
@@ -0,0 +1,122 @@
+#include "mime.hpp"
+
+#include <bit>
+#include <array>
+#include <print>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+// Writes the pack layout expected by `saucer::pack::open`, see "src/pack.cpp" for details.
+
+struct entry
+{
+    fs::path file;
+    std::string path;
+    std::string mime;
+
+  public:
+    std::uint64_t size;
+    std::uint64_t offset;
+};
+
+template <typename T>
+void write(std::ofstream &stream, T value)
+{
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        value = std::byteswap(value);
+    }
+
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        std::println(stderr, "usage: {} <output> <directory>", argv[0]);
+        return 1;
+    }
+
+    const auto output = fs::path{argv[1]};
+    const auto root   = fs::path{argv[2]};
+
+    auto entries = std::vector<entry>{};
+
+    for (const auto &item : fs::recursive_directory_iterator{root})
+    {
+        if (!item.is_regular_file())
+        {
+            continue;
+        }
+
+        auto path = "/" + fs::relative(item.path(), root).generic_string();
+
+        // The mime-type is resolved here, so that opening a pack does not have to sniff (and thus page in) any content.
+        auto head  = std::array<std::uint8_t, 512>{};
+        auto input = std::ifstream{item.path(), std::ios::binary};
+
+        const auto read = input.read(reinterpret_cast<char *>(head.data()), head.size()).gcount();
+        auto mime       = saucer::utils::mime(path, std::span{head}.first(static_cast<std::size_t>(read)));
+
+        entries.emplace_back(item.path(), std::move(path), std::move(mime), item.file_size(), 0);
+    }
+
+    // Sorting keeps the output reproducible, which matters for build caches.
+    std::ranges::sort(entries, {}, &entry::path);
+
+    std::uint64_t offset = 8 + sizeof(std::uint32_t) * 2;
+
+    for (const auto &entry : entries)
+    {
+        offset += sizeof(std::uint64_t) * 2 + sizeof(std::uint32_t) * 2 + entry.path.size() + entry.mime.size();
+    }
+
+    for (auto &entry : entries)
+    {
+        entry.offset = offset;
+        offset += entry.size;
+    }
+
+    auto stream = std::ofstream{output, std::ios::binary | std::ios::trunc};
+
+    stream.write("SAUCERPK", 8);
+    write<std::uint32_t>(stream, 2);
+    write<std::uint32_t>(stream, static_cast<std::uint32_t>(entries.size()));
+
+    for (const auto &entry : entries)
+    {
+        write<std::uint64_t>(stream, entry.offset);
+        write<std::uint64_t>(stream, entry.size);
+        write<std::uint32_t>(stream, static_cast<std::uint32_t>(entry.path.size()));
+
+        stream.write(entry.path.data(), static_cast<std::streamsize>(entry.path.size()));
+
+        write<std::uint32_t>(stream, static_cast<std::uint32_t>(entry.mime.size()));
+        stream.write(entry.mime.data(), static_cast<std::streamsize>(entry.mime.size()));
+    }
+
+    for (const auto &entry : entries)
+    {
+        if (entry.size == 0)
+        {
+            continue;
+        }
+
+        auto input = std::ifstream{entry.file, std::ios::binary};
+        stream << input.rdbuf();
+    }
+
+    if (!stream)
+    {
+        std::println(stderr, "failed to write '{}'", output.string());
+        return 1;
+    }
+
+    return 0;
+}